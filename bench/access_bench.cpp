@@ -0,0 +1,38 @@
+/** ****************************************************************************
+ * \file    access_bench.cpp
+ * \brief   Cost of the access instrumentation
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+
+namespace {
+template <typename P>
+void run(char const *name, std::string const &cline, std::uint64_t const &n) {
+    P const ap(cline);
+    double sum = 0;
+    fsc::bench::report(name, fsc::bench::time_ns(n, [&]() {
+                           sum += ap.get("T", 1.0) + ap.get("mcs", 1);
+                       }) / 2,
+                       "ns");
+    fsc::bench::keep(sum);
+}
+}  // namespace
+
+int main() {
+    std::string const cline =
+        "free0 --mcs 100000 --T=0.5 -L 64 --slow --seed 12345 --other x";
+    std::uint64_t const n = 1000000;
+
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>(
+        "get uninstrumented", cline, n);
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys,
+                          fsc::instrumented>>("get instrumented", cline, n);
+    return 0;
+}
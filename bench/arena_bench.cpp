@@ -0,0 +1,59 @@
+/** ****************************************************************************
+ * \file    arena_bench.cpp
+ * \brief   Heap allocations and time per parse, with the global heap and
+ *          with a std::pmr::monotonic_buffer_resource
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <memory_resource>
+
+namespace {
+template <typename P>
+void run(std::string const &name, std::string const &cline) {
+    std::uint64_t const n = 100000;
+    auto const heap = [&]() {
+        P ap(cline);
+        fsc::bench::keep(ap);
+    };
+    // one buffer for all parses, released after every parser
+    static char buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+    auto const pmr = [&]() {
+        {
+            P ap(cline, &arena);
+            fsc::bench::keep(ap);
+        }
+        arena.release();
+    };
+    fsc::bench::report(name + " heap allocs/parse",
+                       fsc::bench::count_allocations(heap), "");
+    fsc::bench::report(name + " arena allocs/parse",
+                       fsc::bench::count_allocations(pmr), "");
+    fsc::bench::report(name + " heap", fsc::bench::time_ns(n, heap), "ns");
+    fsc::bench::report(name + " arena", fsc::bench::time_ns(n, pmr), "ns");
+}
+}  // namespace
+
+int main() {
+    std::string const cline =
+        "free0 free1 --mcs 100000 --T=0.5 -L 64 --slow "
+        "--output-directory-name=/scratch/some/long/path --seed 12345 "
+        "name=\"quoted value\" --fast";
+    using fsc::hashed_keys;
+    using fsc::lazy_poly_type;
+    using fsc::ordered_keys;
+    using fsc::poly_type;
+    run<fsc::ArgParserTpl<poly_type, ordered_keys>>("eager ordered", cline);
+    run<fsc::ArgParserTpl<poly_type, hashed_keys>>("eager hashed", cline);
+    run<fsc::ArgParserTpl<lazy_poly_type, ordered_keys>>("lazy ordered",
+                                                         cline);
+    run<fsc::ArgParserTpl<lazy_poly_type, hashed_keys>>("lazy hashed", cline);
+    return 0;
+}
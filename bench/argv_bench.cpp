@@ -0,0 +1,50 @@
+/** ****************************************************************************
+ * \file    argv_bench.cpp
+ * \brief   Cost of parsing a typical worker command line from argv
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <vector>
+
+int main() {
+    std::vector<std::string> cline = {"./worker",
+                                      "input.dat",
+                                      "--mcs",
+                                      "100000",
+                                      "--T=0.5",
+                                      "-L",
+                                      "64",
+                                      "--seed",
+                                      "12345",
+                                      "--slow",
+                                      "-v",
+                                      "type=metropolis",
+                                      "--output-directory",
+                                      "/scratch/results/job_000042",
+                                      "-n10",
+                                      "dt=0.01"};
+    std::vector<char *> argv;
+    for(auto &a : cline) argv.push_back(&a[0]);
+    int const argc = argv.size();
+
+    std::uint64_t const n = 100000;
+    auto const allocs = fsc::bench::count_allocations([&]() {
+        fsc::ArgParser ap(argc, argv.data());
+        fsc::bench::keep(ap);
+    });
+    fsc::bench::report("allocs/parse argv (16 tokens)", allocs, "");
+    fsc::bench::report("parse argv (16 tokens)",
+                       fsc::bench::time_ns(n, [&]() {
+                           fsc::ArgParser ap(argc, argv.data());
+                           fsc::bench::keep(ap);
+                       }),
+                       "ns");
+    return 0;
+}
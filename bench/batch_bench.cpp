@@ -0,0 +1,69 @@
+/** ****************************************************************************
+ * \file    batch_bench.cpp
+ * \brief   Parsing a directory of small job files with parse_file on one
+ *          thread and with parse_files on 1, 2, 4, ... threads (up to the
+ *          number of cores)
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParserBatch.hpp>
+#include <sys/stat.h>
+#include <cstdio>
+#include <fstream>
+
+int main() {
+    std::string const dir =
+        "fsc_batch_bench_" + std::to_string(::getpid()) + "/";
+    ::mkdir(dir.c_str(), 0700);
+    std::vector<std::string> names;
+    for(int i = 0; i < 20000; ++i) {
+        names.push_back(dir + "job_" + std::to_string(i) + ".txt");
+        std::ofstream(names.back())
+            << "job_" << i << " --mcs " << 1000 * i << " --T=" << i / 7.
+            << " -L 64 --seed " << 17 * i << " --output=/scratch/run_" << i
+            << " --slow\n";
+    }
+
+    auto const sequential = [&]() {
+        for(auto const &name : names) {
+            fsc::ArgParser ap;
+            ap.parse_file(name);
+            fsc::bench::keep(ap);
+        }
+    };
+    double const seq_ns = fsc::bench::time_ns(1, sequential);
+    fsc::bench::report("parse_file loop", seq_ns / names.size(), "ns/file");
+
+    unsigned const cores = std::max(1u, std::thread::hardware_concurrency());
+    fsc::bench::report("cores", cores, "");
+    for(unsigned threads = 1; threads <= cores; threads *= 2) {
+        double const ns = fsc::bench::time_ns(1, [&]() {
+            auto res = fsc::parse_files(names, threads);
+            fsc::bench::keep(res);
+        });
+        std::string const suffix = " threads=" + std::to_string(threads);
+        fsc::bench::report("parse_files" + suffix, ns / names.size(),
+                           "ns/file");
+        fsc::bench::report("speedup" + suffix, seq_ns / ns, "");
+
+        // one pool per thread, released with the results
+        double const pool_ns = fsc::bench::time_ns(1, [&]() {
+            fsc::batch_pools const pools(threads);
+            auto res = fsc::parse_files(names, pools);
+            fsc::bench::keep(res);
+        });
+        fsc::bench::report("parse_files pools" + suffix,
+                           pool_ns / names.size(), "ns/file");
+        fsc::bench::report("speedup pools" + suffix, seq_ns / pool_ns, "");
+    }
+
+    for(auto const &name : names) std::remove(name.c_str());
+    ::rmdir(dir.c_str());
+    return 0;
+}
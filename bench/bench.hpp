@@ -0,0 +1,163 @@
+/** ****************************************************************************
+ * \file    bench.hpp
+ * \brief   Minimal timing and allocation counting helpers for the benchmarks
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ *
+ * Every benchmark is a single translation unit that includes this header
+ * exactly once, since it replaces the global operator new/delete in order to
+ * count heap allocations.
+ *
+ * All results passed to report() are also written as JSON to the file
+ * named by the environment variable `FSC_BENCH_JSON` (if set) when the
+ * benchmark exits, see the `bench` target.
+ ******************************************************************************/
+
+#ifndef FSC_BENCH_HEADER
+#define FSC_BENCH_HEADER
+
+#include <malloc.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace fsc {
+namespace bench {
+    // atomic, since the multi threaded benchmarks allocate concurrently
+    /// number of calls to the global operator new since program start
+    std::atomic<std::uint64_t> allocations{0};
+    /// bytes currently allocated through the global operator new
+    std::atomic<std::uint64_t> current_bytes{0};
+    /// high water mark of current_bytes since the last reset_peak()
+    std::atomic<std::uint64_t> peak_bytes{0};
+
+    inline void reset_peak() { peak_bytes = current_bytes.load(); }
+
+    /// calls `f` and returns the number of heap allocations it performed
+    template <typename F>
+    std::uint64_t count_allocations(F &&f) {
+        auto const before = allocations.load();
+        f();
+        return allocations - before;
+    }
+
+    /// records an allocation of `bytes`, called by operator new
+    inline void note_allocation(std::uint64_t const &bytes) noexcept {
+        ++allocations;
+        auto const cur = current_bytes += bytes;
+        auto peak = peak_bytes.load(std::memory_order_relaxed);
+        while(peak < cur and !peak_bytes.compare_exchange_weak(
+                                 peak, cur, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// calls `f` `reps` times and returns the average runtime in nanoseconds
+    template <typename F>
+    double time_ns(std::uint64_t const &reps, F &&f) {
+        auto const start = std::chrono::steady_clock::now();
+        for(std::uint64_t i = 0; i < reps; ++i) f();
+        auto const stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(stop - start).count() /
+               reps;
+    }
+
+    /// prevents the compiler from optimizing `t` away
+    template <typename T>
+    void keep(T const &t) {
+        asm volatile("" : : "g"(&t) : "memory");
+    }
+
+    /// collects the reported results and writes them as JSON at exit
+    class json_writer {
+    public:
+        struct result {
+            std::string name;
+            double value;
+            std::string unit;
+        };
+        void add(std::string const &name, double const &value,
+                 std::string const &unit) {
+            results_.push_back(result{name, value, unit});
+        }
+        ~json_writer() {
+            char const *const filename = std::getenv("FSC_BENCH_JSON");
+            if(!filename) return;
+            std::ofstream ofs(filename);
+            ofs << std::setprecision(6) << "{\"results\": [";
+            for(std::size_t i = 0; i < results_.size(); ++i) {
+                auto const &r = results_[i];
+                ofs << (i ? ",\n    " : "\n    ") << "{\"name\": \""
+                    << escape_(r.name) << "\", \"value\": ";
+                if(std::isfinite(r.value))
+                    ofs << r.value;
+                else
+                    ofs << "null";
+                ofs << ", \"unit\": \"" << escape_(r.unit) << "\"}";
+            }
+            ofs << "\n]}\n";
+        }
+
+    private:
+        static std::string escape_(std::string const &str) {
+            std::string res;
+            for(auto const &c : str) {
+                if(c == '"' or c == '\\') res += '\\';
+                res += c;
+            }
+            return res;
+        }
+        std::vector<result> results_;
+    };
+    inline json_writer json;
+
+    inline void report(std::string const &name, double const &value,
+                       std::string const &unit) {
+        std::cout << std::left << std::setw(48) << name << std::right
+                  << std::setw(14) << value << " " << unit << std::endl;
+        json.add(name, value, unit);
+    }
+}  // end namespace bench
+}  // end namespace fsc
+
+void *operator new(std::size_t size) {
+    if(void *p = std::malloc(size ? size : 1)) {
+        fsc::bench::note_allocation(malloc_usable_size(p));
+        return p;
+    }
+    throw std::bad_alloc();
+}
+// std::pmr::new_delete_resource allocates through the aligned overloads
+void *operator new(std::size_t size, std::align_val_t align) {
+    auto const a = std::max(std::size_t(align), sizeof(void *));
+    if(void *p = std::aligned_alloc(a, (std::max<std::size_t>(size, 1) + a - 1) /
+                                           a * a)) {
+        fsc::bench::note_allocation(malloc_usable_size(p));
+        return p;
+    }
+    throw std::bad_alloc();
+}
+// not inlined, gcc would otherwise see malloc/free behind new/delete
+__attribute__((noinline)) static void fsc_bench_free(void *p) noexcept {
+    if(p) fsc::bench::current_bytes -= malloc_usable_size(p);
+    std::free(p);
+}
+void operator delete(void *p) noexcept { fsc_bench_free(p); }
+void operator delete(void *p, std::size_t) noexcept { fsc_bench_free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { fsc_bench_free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+    fsc_bench_free(p);
+}
+
+#endif  // FSC_BENCH_HEADER
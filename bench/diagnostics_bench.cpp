@@ -0,0 +1,61 @@
+/** ****************************************************************************
+ * \file    diagnostics_bench.cpp
+ * \brief   merge with many overwritten keys, per diagnostics mode
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <fstream>
+
+namespace {
+template <typename P>
+void run(std::string const &name, fsc::diagnostics &diag) {
+    std::uint64_t const n = 200;
+    std::string lhs, rhs;
+    for(int i = 0; i < 1000; ++i) {
+        auto const key = "key" + std::to_string(i);
+        lhs += key + "=" + std::to_string(i) + " ";
+        rhs += key + "=" + std::to_string(i + 1) + " ";
+    }
+    P const base(lhs);
+    P const other(rhs);
+    fsc::bench::report(name, fsc::bench::time_ns(n, [&]() {
+                           P ap(base);
+                           ap.set_diagnostics(diag);
+                           ap.merge(other);  // overwrites every key
+                           fsc::bench::keep(ap);
+                       }) / 1000,
+                       "ns/overwrite");
+}
+}  // namespace
+
+int main() {
+    using P = fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>;
+    // what a pipe to a log collector sees, without a terminal in between
+    std::ofstream null("/dev/null");
+    std::ofstream null_unitbuf("/dev/null");
+    null_unitbuf << std::unitbuf;  // flushes every write, as std::endl did
+
+    fsc::diagnostics flushing(null_unitbuf);
+    fsc::diagnostics print(null);
+    fsc::diagnostics silent(fsc::diagnostics::silent);
+    fsc::diagnostics counters(fsc::diagnostics::counters);
+    fsc::diagnostics buffered(fsc::diagnostics::buffered);
+    std::uint64_t calls = 0;
+    fsc::diagnostics callback([&calls](fsc::diag_event const &) { ++calls; });
+
+    run<P>("merge overwrite, flush per warning", flushing);
+    run<P>("merge overwrite, print", print);
+    run<P>("merge overwrite, silent", silent);
+    run<P>("merge overwrite, counters", counters);
+    run<P>("merge overwrite, buffered", buffered);
+    buffered.take();
+    run<P>("merge overwrite, callback", callback);
+    return 0;
+}
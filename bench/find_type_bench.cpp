@@ -0,0 +1,44 @@
+/** ****************************************************************************
+ * \file    find_type_bench.cpp
+ * \brief   Worst case token classification: long runs of short flags
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ *
+ * A run of flags `-a -a -a ...` is the worst case for the flag/named
+ * decision since every token has to look at its successor. The time per
+ * token has to stay flat when the command line grows.
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+
+int main() {
+    // repeated flags warn on std::cout, which is not what we measure
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    std::vector<std::pair<std::uint64_t, double>> res;
+    for(std::uint64_t n = 1000; n <= 64000; n *= 2) {
+        std::string cline;
+        for(std::uint64_t i = 0; i < n; ++i) cline += "-a ";
+
+        auto const reps = 256000 / n;
+        auto const ns = fsc::bench::time_ns(reps, [&]() {
+            fsc::ArgParser ap(cline);
+            fsc::bench::keep(ap);
+            sink.str("");
+        });
+        res.emplace_back(n, ns / n);
+    }
+
+    std::cout.rdbuf(cout_buf);
+    for(auto const &r : res)
+        fsc::bench::report("parse ns/token, tokens=" + std::to_string(r.first),
+                           r.second, "ns");
+    return 0;
+}
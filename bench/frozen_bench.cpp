@@ -0,0 +1,70 @@
+/** ****************************************************************************
+ * \file    frozen_bench.cpp
+ * \brief   Read throughput of a FrozenArgParser and of an ArgParser shared
+ *          by 1, 2, 4, ... threads (up to the number of cores)
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+namespace {
+// every thread reads `n` values, the keys are looked up round robin
+template <typename P>
+double lookups_per_us(P const &ap, std::vector<std::string> const &keys,
+                      unsigned const &threads) {
+    std::uint64_t const n = 2000000;
+    std::atomic<unsigned> ready(0);
+    auto const work = [&](unsigned const &t) {
+        ++ready;
+        while(ready < threads) {
+        }  // start together
+        double sum = 0;
+        for(std::uint64_t i = 0; i < n; ++i) {
+            auto const &key = keys[(i * 7 + t) % keys.size()];
+            sum += double(ap[key]);
+        }
+        fsc::bench::keep(sum);
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    double const ns = fsc::bench::time_ns(1, [&]() {
+        for(unsigned t = 0; t < threads; ++t) pool.emplace_back(work, t);
+        for(auto &th : pool) th.join();
+    });
+    return threads * n / (ns / 1e3);
+}
+}  // namespace
+
+int main() {
+    std::ostringstream oss;
+    for(int i = 0; i < 1000; ++i)
+        oss << "--param_" << i << " " << i << " --scale_" << i << "="
+            << (i + 1) / 3.7 << " ";
+    std::vector<std::string> keys;
+    for(int i = 0; i < 1000; i += 3) {
+        keys.push_back("param_" + std::to_string(i));
+        keys.push_back("scale_" + std::to_string(i));
+    }
+
+    fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys> const ap(oss.str());
+    fsc::FrozenArgParser const fz = ap.freeze();
+    unsigned const cores = std::max(1u, std::thread::hardware_concurrency());
+    fsc::bench::report("cores", cores, "");
+    for(unsigned threads = 1; threads <= cores; threads *= 2) {
+        std::string const suffix = " threads=" + std::to_string(threads);
+        fsc::bench::report("frozen reads" + suffix,
+                           lookups_per_us(fz, keys, threads), "1/us");
+        fsc::bench::report("hashed reads" + suffix,
+                           lookups_per_us(ap, keys, threads), "1/us");
+    }
+    return 0;
+}
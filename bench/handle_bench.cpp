@@ -0,0 +1,48 @@
+/** ****************************************************************************
+ * \file    handle_bench.cpp
+ * \brief   Access with an interned key handle versus a lookup by name
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+
+namespace {
+template <typename P>
+void run(char const *name, std::string const &cline, std::uint64_t const &n) {
+    P ap(cline);
+    auto const dt = ap.handle("dt");
+    auto const mcs = ap.handle("mcs");
+    double sum = 0;
+    fsc::bench::report(std::string("get by name ") + name,
+                       fsc::bench::time_ns(n, [&]() {
+                           sum += ap.get("dt", 0.01) + ap.get("mcs", 1);
+                       }) / 2,
+                       "ns");
+    fsc::bench::report(std::string("get by handle ") + name,
+                       fsc::bench::time_ns(n, [&]() {
+                           sum += ap.get(dt, 0.01) + ap.get(mcs, 1);
+                           fsc::bench::keep(ap);
+                       }) / 2,
+                       "ns");
+    fsc::bench::keep(sum);
+}
+}  // namespace
+
+int main() {
+    std::string const cline =
+        "free0 --mcs 100000 --dt=0.5 -L 64 --slow --seed 12345 --other x "
+        "--temperature 1.5 --output_directory results --interval 100";
+    std::uint64_t const n = 1000000;
+
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>("ordered_keys",
+                                                             cline, n);
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>("hashed_keys",
+                                                            cline, n);
+    return 0;
+}
@@ -0,0 +1,58 @@
+/** ****************************************************************************
+ * \file    key_storage_bench.cpp
+ * \brief   Insertion and lookup of named arguments and flags per key policy
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <random>
+
+namespace {
+template <typename P>
+void run(std::string const &policy, std::uint64_t const &n) {
+    // n named arguments and n flags: --f0 --k0 0 --f1 --k1 1 ...
+    std::vector<std::string> tok;
+    std::vector<std::string> keys;
+    for(std::uint64_t i = 0; i < n; ++i) {
+        tok.push_back("--f" + std::to_string(i));
+        tok.push_back("--k" + std::to_string(i));
+        tok.push_back(std::to_string(i));
+        keys.push_back("k" + std::to_string(i));
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    auto const reps = std::max<std::uint64_t>(1, 100000 / n);
+    auto const parse = fsc::bench::time_ns(reps, [&]() {
+        P ap(tok.begin(), tok.end());
+        fsc::bench::keep(ap);
+    });
+    fsc::bench::report(policy + " insert ns/key, keys=" + std::to_string(n),
+                       parse / (2 * n), "ns");
+
+    P const ap(tok.begin(), tok.end());
+    std::uint64_t const lookups = 1000000;
+    std::uint64_t i = 0;
+    auto const named = fsc::bench::time_ns(lookups, [&]() {
+        int v = ap.get(keys[i++ % n], 0);
+        fsc::bench::keep(v);
+    });
+    fsc::bench::report(policy + " lookup ns/key, keys=" + std::to_string(n),
+                       named, "ns");
+}
+}  // namespace
+
+int main() {
+    for(std::uint64_t n : {10, 1000, 100000}) {
+        run<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>("ordered",
+                                                                   n);
+        run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>("hashed",
+                                                                  n);
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+/** ****************************************************************************
+ * \file    layered_bench.cpp
+ * \brief   Startup with three config layers: merging them into one parser
+ *          versus a LayeredArgParser over them
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/LayeredArgParser.hpp>
+#include <sstream>
+
+namespace {
+std::string config(int const &n, int const &offset) {
+    std::ostringstream oss;
+    for(int i = 0; i < n; ++i) oss << "--key_" << offset + i << " " << i << " ";
+    return oss.str();
+}
+
+template <typename V, typename S>
+void run(std::string const &policy, int const &n) {
+    using P = fsc::ArgParserTpl<V, S>;
+    // overwritten keys warn on std::cout, which is not what we measure
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    P const cline("--key_0 3 --key_17 5");
+    P const job(config(n, n / 2));
+    P const site(config(n, 0));
+    auto const read = [&](auto const &ap) {
+        int sum = ap["key_0"];
+        sum += int(ap["key_17"]) + int(ap.get("key_" + std::to_string(n), 0));
+        sum += ap.get("missing", 0);
+        fsc::bench::keep(sum);
+    };
+    std::uint64_t const reps = n < 100000 ? 200 : 5;
+    double const merge_ns = fsc::bench::time_ns(reps, [&]() {
+        P ap;
+        ap.merge(site);
+        ap.merge(job);
+        ap.merge(cline);
+        read(ap);
+        fsc::bench::keep(ap);
+        sink.str("");
+    });
+    double const layered_ns = fsc::bench::time_ns(reps, [&]() {
+        fsc::LayeredArgParserTpl<V, S> lp(cline, job, site);
+        read(lp);
+        fsc::bench::keep(lp);
+    });
+    std::cout.rdbuf(cout_buf);
+
+    std::string const suffix = " + 4 reads, keys=" + std::to_string(n);
+    fsc::bench::report(policy + " merge" + suffix, merge_ns / 1e3, "us");
+    fsc::bench::report(policy + " layered" + suffix, layered_ns / 1e3, "us");
+}
+}  // namespace
+
+int main() {
+    for(int n : {1000, 100000}) {
+        run<fsc::poly_type, fsc::ordered_keys>("ordered", n);
+        run<fsc::poly_type, fsc::hashed_keys>("hashed", n);
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+/** ****************************************************************************
+ * \file    lazy_bench.cpp
+ * \brief   Parsing a large shared config and reading only a few keys, with
+ *          eager (poly_type) and lazy (lazy_poly_type) values
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+
+namespace {
+template <typename P>
+void run(std::string const &name, std::string const &config) {
+    std::uint64_t const n = 20;
+    auto const f = [&]() {
+        P ap(config);
+        double sum = ap["param_17"];
+        sum += double(ap["param_4711"]) + double(ap["scale_99999"]);
+        std::string s = ap["name_12345"];
+        fsc::bench::keep(sum);
+        fsc::bench::keep(s);
+        fsc::bench::keep(ap);
+    };
+    fsc::bench::report(name + " parse + 4 reads", fsc::bench::time_ns(n, f) / 1e6,
+                       "ms");
+    fsc::bench::report(name + " allocs", fsc::bench::count_allocations(f), "");
+}
+}  // namespace
+
+int main() {
+    std::ostringstream oss;
+    oss.precision(17);
+    for(int i = 0; i < 100000; ++i)
+        oss << "--param_" << i << " " << i << " --scale_" << i << "="
+            << (i + 1) / 3.7e5 << " name_" << i << "=value_" << i << "\n";
+    std::string const config = oss.str();
+    fsc::bench::report("config size", config.size() / 1e6, "MB");
+
+    using fsc::hashed_keys;
+    using fsc::lazy_poly_type;
+    using fsc::ordered_keys;
+    using fsc::poly_type;
+    run<fsc::ArgParserTpl<poly_type, ordered_keys>>("eager ordered", config);
+    run<fsc::ArgParserTpl<lazy_poly_type, ordered_keys>>("lazy ordered",
+                                                         config);
+    run<fsc::ArgParserTpl<poly_type, hashed_keys>>("eager hashed", config);
+    run<fsc::ArgParserTpl<lazy_poly_type, hashed_keys>>("lazy hashed", config);
+    return 0;
+}
@@ -0,0 +1,60 @@
+/** ****************************************************************************
+ * \file    lookup_bench.cpp
+ * \brief   Allocations and cost of successful named argument lookups
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+
+namespace {
+template <typename P>
+void run(std::string const &policy) {
+    P const ap(
+        "--mcs 100000 --T=0.5 -L 64 --slow --output-directory-name=/tmp "
+        "--seed-of-the-random-number-generator 12345");
+
+    std::uint64_t const n = 1000000;
+    auto const report = [&](std::string const &name, auto &&f) {
+        auto const allocs = fsc::bench::count_allocations([&]() {
+            for(std::uint64_t i = 0; i < n; ++i) f();
+        });
+        fsc::bench::report(policy + " allocs/lookup " + name,
+                           double(allocs) / n, "");
+        fsc::bench::report(policy + " " + name, fsc::bench::time_ns(n, f),
+                           "ns");
+    };
+
+    report("operator[] short key", [&]() {
+        int v = ap["mcs"];
+        fsc::bench::keep(v);
+    });
+    report("operator[] long key", [&]() {
+        int v = ap["seed-of-the-random-number-generator"];
+        fsc::bench::keep(v);
+    });
+    report("get short key", [&]() {
+        double v = ap.get("T", 1.);
+        fsc::bench::keep(v);
+    });
+    report("get long key", [&]() {
+        int v = ap.get("seed-of-the-random-number-generator", 0);
+        fsc::bench::keep(v);
+    });
+    report("is_set flag", [&]() {
+        bool v = ap.is_set("slow");
+        fsc::bench::keep(v);
+    });
+}
+}  // namespace
+
+int main() {
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>("ordered");
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>("hashed");
+    return 0;
+}
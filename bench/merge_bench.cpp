@@ -0,0 +1,86 @@
+/** ****************************************************************************
+ * \file    merge_bench.cpp
+ * \brief   Cost of merging large parsers, with and without overwrite
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+
+namespace {
+// `n` named arguments and n / 10 flags, every second key also in the other
+// half, i.e. half of the keys collide on merge
+std::string config(int const &n, int const &offset) {
+    std::ostringstream oss;
+    for(int i = 0; i < n; ++i) {
+        int const k = offset + i;
+        oss << "--key_" << k << " " << k * 0.5 << " ";
+        if(k % 10 == 0) oss << "--flag_" << k << " ";
+    }
+    return oss.str();
+}
+
+template <typename P>
+void run(std::string const &policy, int const &n) {
+    // overwritten keys warn on std::cout, which is not what we measure
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    P const lhs(config(n, 0));
+    P const rhs(config(n, n / 2));
+    // both sides are copied for every merge, the copies are timed
+    // separately and are not part of the result
+    auto const merge = [&](bool const &overwrite, bool const &move) {
+        P ap(lhs);
+        P other(rhs);
+        if(move)
+            ap.merge(std::move(other), overwrite);
+        else
+            ap.merge(other, overwrite);
+        fsc::bench::keep(ap);
+        sink.str("");
+    };
+    auto const copy = [&]() {
+        P ap(lhs);
+        P other(rhs);
+        fsc::bench::keep(ap);
+        fsc::bench::keep(other);
+    };
+    std::uint64_t const reps = n < 100000 ? 20 : 3;
+    double const copy_ns = fsc::bench::time_ns(reps, copy);
+    auto const time = [&](bool const &overwrite, bool const &move) {
+        return (fsc::bench::time_ns(reps, [&]() { merge(overwrite, move); }) -
+                copy_ns) /
+               n;
+    };
+    double const overwrite_ns = time(true, false);
+    double const keep_ns = time(false, false);
+    double const move_overwrite_ns = time(true, true);
+    double const move_keep_ns = time(false, true);
+    std::cout.rdbuf(cout_buf);
+
+    std::string const suffix = " ns/key, keys=" + std::to_string(n);
+    fsc::bench::report(policy + " merge overwrite" + suffix, overwrite_ns,
+                       "ns");
+    fsc::bench::report(policy + " merge keep" + suffix, keep_ns, "ns");
+    fsc::bench::report(policy + " merge&& overwrite" + suffix,
+                       move_overwrite_ns, "ns");
+    fsc::bench::report(policy + " merge&& keep" + suffix, move_keep_ns,
+                       "ns");
+}
+}  // namespace
+
+int main() {
+    for(int n : {1000, 100000}) {
+        run<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>("ordered",
+                                                                   n);
+        run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>("hashed", n);
+    }
+    return 0;
+}
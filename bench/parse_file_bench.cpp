@@ -0,0 +1,73 @@
+/** ****************************************************************************
+ * \file    parse_file_bench.cpp
+ * \brief   Time and peak heap usage of parse_file on a large generated file
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <fsc/ArgParser.hpp>
+#include <fstream>
+#include <sstream>
+
+namespace {
+// what parse_file used to do: read into a string, parse into a temporary
+// ArgParser and merge it
+template <typename P>
+void legacy_parse_file(P &ap, std::string const &filename) {
+    std::ifstream ifs(filename, std::ios_base::in);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+    std::string const res = buffer.str();
+    ap.merge(P(res));
+}
+
+template <typename P>
+void run(std::string const &policy, std::string const &filename,
+         double const &mb) {
+    auto const measure = [&](std::string const &name, auto &&f) {
+        fsc::bench::reset_peak();
+        auto const before = fsc::bench::current_bytes.load();
+        auto const start = std::chrono::steady_clock::now();
+        {
+            P ap;
+            f(ap);
+            fsc::bench::keep(ap);
+        }
+        auto const stop = std::chrono::steady_clock::now();
+        double const s = std::chrono::duration<double>(stop - start).count();
+        fsc::bench::report(policy + " " + name + " time", s * 1e3, "ms");
+        fsc::bench::report(policy + " " + name + " throughput", mb / s,
+                           "MB/s");
+        fsc::bench::report(policy + " " + name + " peak heap",
+                           (fsc::bench::peak_bytes - before) / 1e6, "MB");
+    };
+    measure("read+merge", [&](P &ap) { legacy_parse_file(ap, filename); });
+    measure("parse_file", [&](P &ap) { ap.parse_file(filename); });
+}
+}  // namespace
+
+int main() {
+    std::string const filename = "parse_file_bench.txt";
+    {
+        std::ofstream ofs(filename);
+        for(int i = 0; i < 400000; ++i)
+            ofs << "--param_" << i << " " << i * 0.5 << "\n"
+                << "name_" << i << "=value_" << i << "\n";
+    }
+    std::ifstream ifs(filename, std::ios::ate);
+    double const mb = ifs.tellg() / 1e6;
+    fsc::bench::report("file size", mb, "MB");
+
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>("ordered",
+                                                               filename, mb);
+    run<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>("hashed",
+                                                              filename, mb);
+    std::remove(filename.c_str());
+    return 0;
+}
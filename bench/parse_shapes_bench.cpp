@@ -0,0 +1,78 @@
+/** ****************************************************************************
+ * \file    parse_shapes_bench.cpp
+ * \brief   Parsing synthetic command lines of different shapes
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <functional>
+#include <sstream>
+
+namespace {
+// a command line of `n` arguments, `arg(i)` writes the i-th one
+std::string cline(int const &n, std::function<void(std::ostream &, int)> arg) {
+    std::ostringstream oss;
+    for(int i = 0; i < n; ++i) {
+        arg(oss, i);
+        oss << " ";
+    }
+    return oss.str();
+}
+
+void run(std::string const &name, std::string const &str, int const &n) {
+    auto const reps = 200000 / n;
+    fsc::bench::report(name + " ns/arg, args=" + std::to_string(n),
+                       fsc::bench::time_ns(reps,
+                                           [&]() {
+                                               fsc::ArgParser ap(str);
+                                               fsc::bench::keep(ap);
+                                           }) /
+                           n,
+                       "ns");
+}
+}  // namespace
+
+int main() {
+    for(int n : {10, 1000, 10000}) {
+        run("flags", cline(n, [](std::ostream &os, int i) { os << "--f" << i; }),
+            n);
+        run("named --key v", cline(n, [](std::ostream &os, int i) {
+                os << "--key_" << i << " " << i;
+            }),
+            n);
+        run("named --key=v", cline(n, [](std::ostream &os, int i) {
+                os << "--key_" << i << "=" << i;
+            }),
+            n);
+        run("free", cline(n, [](std::ostream &os, int i) { os << i * 0.5; }),
+            n);
+        run("mixed", cline(n, [](std::ostream &os, int i) {
+                switch(i % 4) {
+                    case 0:
+                        os << "--name_" << i << " value";
+                        break;
+                    case 1:
+                        os << i * 0.5;
+                        break;
+                    case 2:
+                        os << "--flag_" << i;
+                        break;
+                    default:
+                        os << "k" << i << "=" << i;
+                }
+            }),
+            n);
+        run("long keys", cline(n, [](std::ostream &os, int i) {
+                os << "--output-directory-of-the-simulation-" << i
+                   << " /scratch/results";
+            }),
+            n);
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+/** ****************************************************************************
+ * \file    poly_type_bench.cpp
+ * \brief   Heap allocations and cost of poly_type values
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+#include <vector>
+
+namespace {
+// construct, copy and reassign a value, i.e. what the parser does with every
+// argument it stores
+template <typename T>
+void roundtrip(T const &t) {
+    fsc::poly_type p(t);
+    fsc::poly_type q(p);
+    q = p;
+    q = t;
+    fsc::bench::keep(q);
+}
+template <typename T>
+void report_value(std::string const &name, T const &t) {
+    std::uint64_t const n = 100000;
+    auto const allocs = fsc::bench::count_allocations([&]() {
+        for(std::uint64_t i = 0; i < n; ++i) roundtrip(t);
+    });
+    fsc::bench::report("allocs/value " + name, double(allocs) / n, "");
+    fsc::bench::report("roundtrip " + name,
+                       fsc::bench::time_ns(n, [&]() { roundtrip(t); }), "ns");
+}
+}  // namespace
+
+int main() {
+    report_value("int", 42);
+    report_value("double", 3.14);
+    report_value("bool", true);
+    report_value("short string", std::string("sim"));
+    report_value("long string", std::string("a string beyond the sso buffer"));
+
+    // the parsed values of a numeric command line
+    std::stringstream ss;
+    std::uint64_t const n = 1000;
+    for(std::uint64_t i = 0; i < n; ++i) ss << " " << i << " " << i + 0.5;
+    fsc::ArgParser const ap(ss.str());
+
+    std::vector<fsc::poly_type> values;
+    values.reserve(ap.freeargc());
+    auto const allocs = fsc::bench::count_allocations([&]() {
+        for(std::uint64_t i = 0; i < ap.freeargc(); ++i) values.push_back(ap[i]);
+    });
+    fsc::bench::report("allocs/parsed numeric argument",
+                       double(allocs) / ap.freeargc(), "");
+
+    fsc::poly_type acc = 0;
+    fsc::bench::report("arithmetic int += double",
+                       fsc::bench::time_ns(n, [&]() { acc += 0.5; }), "ns");
+    fsc::bench::keep(acc);
+
+    fsc::poly_type const a = 3, b = 2.5, s = std::string("sim");
+    fsc::bench::report("arithmetic int * double",
+                       fsc::bench::time_ns(n, [&]() {
+                           fsc::poly_type r = a * b;
+                           fsc::bench::keep(r);
+                       }),
+                       "ns");
+    fsc::bench::report("cast int", fsc::bench::time_ns(n, [&]() {
+                           int r = a;
+                           fsc::bench::keep(r);
+                       }),
+                       "ns");
+    fsc::bench::report("cast int to double", fsc::bench::time_ns(n, [&]() {
+                           double r = a;
+                           fsc::bench::keep(r);
+                       }),
+                       "ns");
+    fsc::bench::report("cast string", fsc::bench::time_ns(n, [&]() {
+                           std::string r = s;
+                           fsc::bench::keep(r);
+                       }),
+                       "ns");
+    return 0;
+}
@@ -0,0 +1,53 @@
+/** ****************************************************************************
+ * \file    reparse_bench.cpp
+ * \brief   A new parser per command line versus reparse() of one parser
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgParser.hpp>
+
+namespace {
+template <typename P>
+void run(std::string const &name, std::string const &cline) {
+    std::uint64_t const n = 100000;
+    auto const fresh = [&]() {
+        P ap(cline);
+        fsc::bench::keep(ap);
+    };
+    P ap;
+    auto const reuse = [&]() {
+        ap.reparse(cline);
+        fsc::bench::keep(ap);
+    };
+    reuse();  // warm up the buffers
+    fsc::bench::report(name + " new allocs/parse",
+                       fsc::bench::count_allocations(fresh), "");
+    fsc::bench::report(name + " reparse allocs/parse",
+                       fsc::bench::count_allocations(reuse), "");
+    fsc::bench::report(name + " new", fsc::bench::time_ns(n, fresh), "ns");
+    fsc::bench::report(name + " reparse", fsc::bench::time_ns(n, reuse), "ns");
+}
+}  // namespace
+
+int main() {
+    std::string const cline =
+        "free0 free1 --mcs 100000 --T=0.5 -L 64 --slow "
+        "--output-directory-name=/scratch/some/long/path --seed 12345 "
+        "name=\"quoted value\" --fast";
+    using fsc::hashed_keys;
+    using fsc::lazy_poly_type;
+    using fsc::ordered_keys;
+    using fsc::poly_type;
+    run<fsc::ArgParserTpl<poly_type, ordered_keys>>("eager ordered", cline);
+    run<fsc::ArgParserTpl<poly_type, hashed_keys>>("eager hashed", cline);
+    run<fsc::ArgParserTpl<lazy_poly_type, ordered_keys>>("lazy ordered",
+                                                         cline);
+    run<fsc::ArgParserTpl<lazy_poly_type, hashed_keys>>("lazy hashed", cline);
+    return 0;
+}
@@ -0,0 +1,33 @@
+# runs all benchmarks and collects their results into one JSON file
+#
+# cmake -DBENCH_DIR=<dir> -DBENCHES=<name:name:...> -DOUTPUT=<file>
+#       -DCOMPILER=<id version> -DFLAGS=<flags> -P run_bench.cmake
+
+string(REPLACE ":" ";" BENCHES "${BENCHES}")
+string(TIMESTAMP NOW "%Y-%m-%dT%H:%M:%SZ" UTC)
+
+set(json "{\n\"compiler\": \"${COMPILER}\",\n\"flags\": \"${FLAGS}\",\n")
+set(json "${json}\"date\": \"${NOW}\",\n\"benchmarks\": [")
+set(sep "\n")
+foreach(name ${BENCHES})
+    message(STATUS "running ${name}")
+    set(partial "${BENCH_DIR}/${name}.json")
+    file(REMOVE ${partial})
+    execute_process(COMMAND ${CMAKE_COMMAND} -E env FSC_BENCH_JSON=${partial}
+                            ${BENCH_DIR}/${name}
+                    WORKING_DIRECTORY ${BENCH_DIR}
+                    RESULT_VARIABLE res)
+    if(NOT res EQUAL 0)
+        message(FATAL_ERROR "${name} failed: ${res}")
+    endif()
+    file(READ ${partial} results)
+    # {"results": [...]} -> "results": [...]
+    string(STRIP "${results}" results)
+    string(REGEX REPLACE "^{(.*)}$" "\\1" results "${results}")
+    set(json "${json}${sep}{\"name\": \"${name}\", ${results}}")
+    set(sep ",\n")
+endforeach()
+set(json "${json}\n]}\n")
+
+file(WRITE ${OUTPUT} "${json}")
+message(STATUS "results written to ${OUTPUT}")
@@ -0,0 +1,55 @@
+/** ****************************************************************************
+ * \file    schema_bench.cpp
+ * \brief   Access of a schema slot versus a lookup by name
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgSchema.hpp>
+
+int main() {
+    std::string const cline =
+        "free0 --mcs 100000 --T=0.5 -L 64 --slow --seed 12345 --other x";
+    std::uint64_t const n = 1000000;
+
+    fsc::Schema schema;
+    auto const mcs = schema.add<int>("mcs");
+    auto const temp = schema.add<double>("T");
+    schema.add<int>("L");
+    schema.add<int>("seed");
+    schema.add<bool>("slow");
+
+    fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys> const hashed(cline);
+    fsc::SchemaArgParser const ap(schema, cline);
+
+    double sum = 0;
+    fsc::bench::report("get hashed_keys", fsc::bench::time_ns(n, [&]() {
+                           sum += int(hashed["mcs"]) + double(hashed["T"]);
+                       }) / 2,
+                       "ns");
+    fsc::bench::report("get schema slot", fsc::bench::time_ns(n, [&]() {
+                           sum += ap.slot(mcs) + ap.slot(temp);
+                           fsc::bench::keep(ap);
+                       }) / 2,
+                       "ns");
+    fsc::bench::keep(sum);
+
+    std::uint64_t const m = 100000;
+    fsc::bench::report("parse hashed_keys", fsc::bench::time_ns(m, [&]() {
+                           fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>
+                               p(cline);
+                           fsc::bench::keep(p);
+                       }),
+                       "ns");
+    fsc::bench::report("parse schema", fsc::bench::time_ns(m, [&]() {
+                           fsc::SchemaArgParser p(schema, cline);
+                           fsc::bench::keep(p);
+                       }),
+                       "ns");
+    return 0;
+}
@@ -0,0 +1,70 @@
+/** ****************************************************************************
+ * \file    spec_bench.cpp
+ * \brief   Access of a compile time key versus a lookup by name
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <fsc/ArgSpec.hpp>
+
+namespace {
+struct mcs : fsc::key<int> {
+    static constexpr std::string_view name = "mcs";
+};
+struct temp : fsc::key<double> {
+    static constexpr std::string_view name = "T";
+};
+struct size : fsc::key<int> {
+    static constexpr std::string_view name = "L";
+};
+struct seed : fsc::key<int> {
+    static constexpr std::string_view name = "seed";
+};
+struct slow : fsc::flag {
+    static constexpr std::string_view name = "slow";
+};
+}  // namespace
+
+int main() {
+    std::string const cline =
+        "free0 --mcs 100000 --T=0.5 -L 64 --slow --seed 12345 --other x";
+    std::uint64_t const n = 1000000;
+
+    fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys> const ordered(cline);
+    fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys> const hashed(cline);
+    fsc::ArgSpec<mcs, temp, size, seed, slow> const spec(cline);
+
+    double sum = 0;
+    fsc::bench::report("get ordered_keys", fsc::bench::time_ns(n, [&]() {
+                           sum += int(ordered["mcs"]) + double(ordered["T"]);
+                       }) / 2,
+                       "ns");
+    fsc::bench::report("get hashed_keys", fsc::bench::time_ns(n, [&]() {
+                           sum += int(hashed["mcs"]) + double(hashed["T"]);
+                       }) / 2,
+                       "ns");
+    fsc::bench::report("get ArgSpec", fsc::bench::time_ns(n, [&]() {
+                           sum += spec.get<mcs>() + spec.get<temp>();
+                           fsc::bench::keep(spec);
+                       }) / 2,
+                       "ns");
+    fsc::bench::keep(sum);
+
+    std::uint64_t const m = 100000;
+    fsc::bench::report("parse ordered_keys", fsc::bench::time_ns(m, [&]() {
+                           fsc::ArgParser ap(cline);
+                           fsc::bench::keep(ap);
+                       }),
+                       "ns");
+    fsc::bench::report("parse ArgSpec", fsc::bench::time_ns(m, [&]() {
+                           fsc::ArgSpec<mcs, temp, size, seed, slow> s(cline);
+                           fsc::bench::keep(s);
+                       }),
+                       "ns");
+    return 0;
+}
@@ -0,0 +1,62 @@
+/** ****************************************************************************
+ * \file    str_to_type_bench.cpp
+ * \brief   Cost of turning parsed tokens into values for int/double/string
+ *          mixes
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <fsc/ArgParser.hpp>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+std::string token(std::mt19937 &rng, int const &kind) {
+    switch(kind) {
+        case 0:
+            // no negative numbers, they would be taken as -k value
+            return std::to_string(rng() % 1000000);
+        case 1: {
+            std::ostringstream oss;
+            oss.precision(17);
+            oss << std::uniform_real_distribution<double>(0, 1e3)(rng);
+            return oss.str();
+        }
+        default:
+            return "/scratch/run_" + std::to_string(rng() % 1000);
+    }
+}
+
+// n free arguments, `percent[k]` of them of kind k (int, double, string)
+void run(std::string const &name, std::vector<int> const &percent) {
+    std::mt19937 rng(42);
+    std::vector<std::string> tokens;
+    int const n = 10000;
+    for(int k = 0; k < 3; ++k)
+        for(int i = 0; i < n * percent[k] / 100; ++i)
+            tokens.push_back(token(rng, k));
+    std::shuffle(tokens.begin(), tokens.end(), rng);
+
+    auto const parse = [&]() {
+        fsc::ArgParser ap(tokens.begin(), tokens.end());
+        fsc::bench::keep(ap);
+    };
+    fsc::bench::report("str_to_type ns/token " + name,
+                       fsc::bench::time_ns(50, parse) / tokens.size(), "ns");
+}
+}  // namespace
+
+int main() {
+    run("int", {100, 0, 0});
+    run("double", {0, 100, 0});
+    run("string", {0, 0, 100});
+    run("int/double/string 40/40/20", {40, 40, 20});
+    return 0;
+}
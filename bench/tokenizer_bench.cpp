@@ -0,0 +1,91 @@
+/** ****************************************************************************
+ * \file    tokenizer_bench.cpp
+ * \brief   Throughput of splitting a large command line string into tokens
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <fsc/ArgParser.hpp>
+#include <iterator>
+#include <sstream>
+
+namespace {
+// what the string constructor did originally: a std::string per token
+std::size_t legacy_split(std::string const &str) {
+    std::istringstream iss(str);
+    std::vector<std::string> res{std::istream_iterator<std::string>{iss},
+                                 std::istream_iterator<std::string>{}};
+    fsc::bench::keep(res);
+    return res.size();
+}
+// the white-space only splitter the tokenizer replaced
+std::size_t whitespace_split(std::string const &str) {
+    std::size_t n = 0;
+    auto const *p = str.data();
+    auto const *const e = p + str.size();
+    while(true) {
+        p = std::find_if_not(p, e, fsc::detail::is_space);
+        if(p == e) break;
+        auto const *const q = std::find_if(p, e, fsc::detail::is_space);
+        std::string_view tok(p, q - p);
+        fsc::bench::keep(tok);
+        ++n;
+        p = q;
+    }
+    return n;
+}
+template <fsc::detail::simd S>
+std::size_t tokenize(std::string const &str) {
+    std::size_t n = 0;
+    fsc::detail::basic_tokenizer<S> tok(str);
+    for(auto const &t : tok) {
+        fsc::bench::keep(t);
+        ++n;
+    }
+    return n;
+}
+
+void run(std::string const &label, std::string const &input) {
+    double const mb = input.size() / 1e6;
+    auto const measure = [&](std::string const &name, auto &&f) {
+        std::size_t n = 0;
+        double const ns = fsc::bench::time_ns(5, [&]() { n = f(input); });
+        fsc::bench::report(label + " " + name, mb / (ns * 1e-9), "MB/s");
+        return n;
+    };
+    fsc::bench::report(label + " size", mb, "MB");
+    measure("istream_iterator", legacy_split);
+    measure("white-space only", whitespace_split);
+    measure("tokenizer scalar", tokenize<fsc::detail::simd::scalar>);
+#if defined(__SSE2__)
+    measure("tokenizer sse2", tokenize<fsc::detail::simd::sse2>);
+#endif
+#if defined(__AVX2__)
+    measure("tokenizer avx2", tokenize<fsc::detail::simd::avx2>);
+#endif
+}
+}  // namespace
+
+int main() {
+    std::ostringstream plain, indented, quoted;
+    for(int i = 0; i < 200000; ++i) {
+        plain << "--param_" << i << " " << i * 0.5 << "\n"
+              << "name_" << i << "=value_" << i << "\n";
+        // config files with aligned values and long paths
+        indented << "    --output-directory_" << i
+                 << "                /scratch/results/job_" << i
+                 << "/run/output.dat\n";
+        quoted << "--title_" << i << " 'run " << i << " of many' msg_" << i
+               << "=\"a \\\"quoted\\\" value\"\n";
+    }
+    run("plain", plain.str());
+    run("indented", indented.str());
+    run("quoted", quoted.str());
+    return 0;
+}
@@ -0,0 +1,38 @@
+/** ****************************************************************************
+ * \file    layered_example.cpp
+ * \brief   LayeredArgParser Example
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <fsc/LayeredArgParser.hpp>
+#include <iostream>
+
+int main() {
+
+    fsc::ArgParser cline("free0 --mcs 20 --slow");
+    fsc::ArgParser job("--mcs 10 --type=sim -n5");
+    fsc::ArgParser site("-n1 --T 0.5 --fast");
+
+    fsc::LayeredArgParser lp(cline, job, site);
+    // lp has now the named arguments: mcs = 20, type = sim, n = 5, T = 0.5
+    //                 free arguments: free0
+    //                          flags: slow fast
+    std::cout << "mcs  = " << lp["mcs"] << std::endl;
+    std::cout << "n    = " << lp["n"] << std::endl;
+    std::cout << "T    = " << lp.get("T", 1.0) << std::endl;
+    std::cout << "fast = " << lp.is_set("fast") << std::endl;
+
+    // only the job layer is replaced, the others are not touched
+    fsc::ArgParser reloaded("--type=mc -n7");
+    lp.set_layer(1, reloaded);
+    // lp has now the named arguments: mcs = 20, type = mc, n = 7, T = 0.5
+    std::cout << "type = " << lp["type"] << std::endl;
+
+    std::cout << lp.merged() << std::endl;
+
+    return 0;
+}
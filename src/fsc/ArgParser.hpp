@@ -17,8 +17,6 @@
  * str_to_type_ -> make -B pretty -j3
  * doc
  *
- * implement split_clean()
- *
  * V2:
  * contract pwd nicely!
  * struct converter {
@@ -34,32 +32,44 @@
 #ifndef FSC_ARGPARSER_HEADER
 #define FSC_ARGPARSER_HEADER
 
-#include "ArgParser/boost_any.hpp"
+#include "ArgParser/access_stats.hpp"
+#include "ArgParser/diagnostics.hpp"
+#include "ArgParser/frozen.hpp"
 #include "ArgParser/fsc_except.hpp"
+#include "ArgParser/key_handle.hpp"
+#include "ArgParser/key_storage.hpp"
+#include "ArgParser/mapped_file.hpp"
+#include "ArgParser/number_token.hpp"
 #include "ArgParser/poly_type.hpp"
+#include "ArgParser/tokenizer.hpp"
 
 #include <fsc/stdSupport.hpp>
 
 #include <unistd.h>
 #include <algorithm>
-#include <fstream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
-#include <map>
-#include <sstream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
 #include <vector>
 
 namespace fsc {
 /// @cond NEVER_DOCUMENT_THIS_ENTITY
 namespace detail {
-    std::string get_progname(std::string pwd_name) {
+    inline std::string get_progname(std::string pwd_name) {
         auto pos = pwd_name.rfind("/");
         if(pos == std::string::npos) return pwd_name;
 
         pwd_name.erase(0, pos + 1);
         return pwd_name;
     }
-    std::string get_pwd(std::string pwd_name, std::string const &cwd) {
+    inline std::string get_pwd(std::string pwd_name, std::string const &cwd) {
         auto pos = pwd_name.rfind("/");
         if(pos == std::string::npos) return cwd;
 
@@ -67,57 +77,173 @@ namespace detail {
 
         return cwd + "/" + pwd_name;
     }
-    std::vector<std::string> split_clean(std::string const &str) {
-        std::stringstream iss(str);
-        return std::vector<std::string>{std::istream_iterator<std::string>{iss},
-                                        std::istream_iterator<std::string>{}};
-    }
+    /* cwd, pwd and progname of an ArgParserTpl. The cwd (and the pwd,
+     * which needs it) is looked up on the first access and cached, i.e. a
+     * parser that never asks for it does not call getcwd. The first access
+     * takes a lock, later ones only check an atomic flag, i.e. a const
+     * parser can be read from several threads. An empty string means not
+     * set (or disabled).
+     */
+    class process_paths {
+    public:
+        explicit process_paths(bool const &enabled = true) noexcept
+            : enabled_(enabled) {}
+        process_paths(process_paths const &rhs) { *this = rhs; }
+        process_paths(process_paths &&rhs) noexcept {
+            *this = std::move(rhs);
+        }
+        // rhs may be resolved by a reader at the same time, `this` not
+        process_paths &operator=(process_paths const &rhs) {
+            if(this == &rhs) return *this;
+            std::lock_guard<std::mutex> lock(rhs.m_);
+            enabled_ = rhs.enabled_;
+            argv0_ = rhs.argv0_;
+            progname_ = rhs.progname_;
+            cwd_ = rhs.cwd_;
+            pwd_ = rhs.pwd_;
+            resolved_.store(rhs.resolved_.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+            return *this;
+        }
+        process_paths &operator=(process_paths &&rhs) noexcept {
+            enabled_ = rhs.enabled_;
+            argv0_ = std::move(rhs.argv0_);
+            progname_ = std::move(rhs.progname_);
+            cwd_ = std::move(rhs.cwd_);
+            pwd_ = std::move(rhs.pwd_);
+            resolved_.store(rhs.resolved_.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+            return *this;
+        }
+        /// pwd and progname are derived from `argv0`
+        void set_argv0(char const *argv0) {
+            if(!enabled_) return;
+            argv0_ = argv0;
+            progname_ = get_progname(argv0_);
+            resolved_.store(false, std::memory_order_relaxed);
+        }
+        bool enabled() const noexcept { return enabled_; }
 
-    template <typename map_type>
-    struct verbose_map : public map_type {
-        using typename map_type::key_type;
-        using typename map_type::mapped_type;
+        std::string const &cwd() const {
+            resolve_();
+            return cwd_;
+        }
+        std::string const &pwd() const {
+            resolve_();
+            return pwd_;
+        }
+        std::string const &progname() const noexcept { return progname_; }
 
-        mapped_type const &at(key_type const &key) const {
-            try {
-                return map_type::at(key);
-            } catch(std::out_of_range) {
-                throw std::out_of_range("map::at: key \"" + key +
-                                        "\" not found!");
+    private:
+        void resolve_() const {
+            if(resolved_.load(std::memory_order_acquire)) return;
+            std::lock_guard<std::mutex> lock(m_);
+            if(resolved_.load(std::memory_order_relaxed)) return;
+            if(enabled_) {
+                std::unique_ptr<char, void (*)(void *)> buf(getcwd(nullptr, 0),
+                                                            std::free);
+                if(buf) cwd_ = buf.get();
+                if(!argv0_.empty() and !cwd_.empty())
+                    pwd_ = get_pwd(argv0_, cwd_);
             }
+            resolved_.store(true, std::memory_order_release);
         }
-    };
 
+        bool enabled_;
+        std::string argv0_;
+        std::string progname_;
+        mutable std::string cwd_;
+        mutable std::string pwd_;
+        mutable std::atomic<bool> resolved_{false};
+        mutable std::mutex m_;  // only taken until resolved_
+    };
 }  // end namespace detail
    /// @endcond
 
+template <typename P, typename... Keys>
+class ArgSpecTpl;
+template <typename P>
+class SchemaArgParserTpl;
+template <typename VT, typename SP, typename IP>
+class LayeredArgParserTpl;
+
+/** @brief constructor tag of fsc::ArgParserTpl, the parser has no cwd, pwd
+ * and progname
+ *
+ * `fsc::ArgParser ap(cline, fsc::no_paths);`
+ */
+struct no_paths_t {
+    explicit no_paths_t() = default;
+};
+inline constexpr no_paths_t no_paths{};
+
 /** @brief an argument parser that does not require registration.
  *
  * ### Usage:
  * For details and more examples, see the fsc::ArgParser member function
  * documentation.
  * \include mixed_example.cpp
+ *
+ * `VT` is the type of the argument values, `SP` the policy that stores
+ * named arguments and flags (fsc::ordered_keys or fsc::hashed_keys), `IP`
+ * whether the accesses are recorded to fsc::access_stats
+ * (fsc::uninstrumented or fsc::instrumented).
  */
-template <typename VT = poly_type>
+template <typename VT = poly_type, typename SP = ordered_keys,
+          typename IP = uninstrumented>
 class ArgParserTpl {
+    template <typename P, typename... Keys>
+    friend class ArgSpecTpl;  // parses with a hook
+    template <typename P>
+    friend class SchemaArgParserTpl;
+    template <typename, typename, typename>
+    friend class LayeredArgParserTpl;  // looks up flags without recording
+
 public:
     using value_type = VT;  ///< the mapped value of the arguments
 private:
     //~ using poly_type = __future_impl;
-    using map_type =
-        detail::verbose_map<std::map<std::string, value_type>>;  ///<
+    using store_type = typename SP::template store<value_type>;
+    using map_type = typename store_type::named_type;  ///<
+    using flag_type = typename store_type::flag_type;
     template <typename U>
-    using vec_type = std::vector<U>;
+    using vec_type = std::pmr::vector<U>;
     using size_type = typename vec_type<
         value_type>::size_type;  ///< std::vector<value_type>::size_type
 public:
     //------------------- structors -------------------
     /**@brief default constructor
      *
-     * does not generate pwd and progname.
+     * does not generate pwd and progname. The cwd is only looked up when it
+     * is needed, none of the constructors makes a system call.
      */
     ArgParserTpl() noexcept
-        : cwd_(getcwd(nullptr, 0)), pwd_(""), progname_("") {}
+        : ArgParserTpl(std::pmr::get_default_resource()) {}
+    /**@brief an empty parser that allocates from `res`
+     * @param res is the memory resource of the parser, it has to outlive it
+     *
+     * Free arguments, lazy tokens, the keys and their index are allocated
+     * from `res`, e.g. a std::pmr::monotonic_buffer_resource that is
+     * released in one step once the parser is gone. A copy of the parser
+     * uses the default resource again, a moved parser keeps `res`. Strings
+     * in eager fsc::poly_type values still use the global heap, see the
+     * README for the allocations per parse.
+     * Does not generate pwd and progname.
+     */
+    explicit ArgParserTpl(std::pmr::memory_resource *res) noexcept
+        : keys_(res), f_args_(res), tokens_(res) {}
+    /**@brief an empty parser without cwd, pwd and progname
+     * @param res is the memory resource of the parser, it has to outlive it
+     *
+     * cwd(), pwd() and progname() throw, also after a merge of a parser
+     * that has them, and getcwd is never called. Merging it into another
+     * parser does not change the paths of the other parser. Meant for parsers of
+     * strings in hot loops, see reparse().
+     */
+    explicit ArgParserTpl(
+        no_paths_t,
+        std::pmr::memory_resource *res = std::pmr::get_default_resource())
+        : keys_(res), f_args_(res), tokens_(res), paths_(false) {}
     /**@brief construct from command line
      * @param argc length of argv
      * @param argv array of arguments given via command line
@@ -127,37 +253,79 @@ public:
      * Throws a std::runtime_error if the command line is ill-formed.
      */
     ArgParserTpl(int const &argc, char *argv[])
-        : cwd_(getcwd(nullptr, 0)),
-          pwd_(detail::get_pwd(argv[0], cwd_)),
-          progname_(detail::get_progname(argv[0])) {
-        vec_type<std::string> arg;
-        for(int i = 1; i < argc; ++i)  // 1 since we dont need the progname
-            arg.push_back(argv[i]);
-        parse_(arg);
+        : ArgParserTpl(argc, argv, std::pmr::get_default_resource()) {}
+    /**@brief construct from command line, allocate from `res`
+     *
+     * See the constructors from `argc, argv` and from a memory resource.
+     */
+    ArgParserTpl(int const &argc, char *argv[], std::pmr::memory_resource *res)
+        : ArgParserTpl(res) {
+        paths_.set_argv0(argv[0]);
+        parse_(argv + 1, argv + argc);  // 1 since we dont need the progname
     }
     /**@brief string constructor
      * @param cline a string that simulates a command line
      *
      * construct the ArgParser with a string instead of the command line to
-     * parse.
-     * Throws a std::runtime_error if the string is ill-formed.
+     * parse. The string is split like a shell would, i.e. `'...'`, `"..."`
+     * and backslashes quote white-space. The tokens are parsed in place,
+     * only keys and string values are copied into the ArgParser.
+     * Throws a std::runtime_error if the string is ill-formed, e.g. if a
+     * quote is not terminated.
      * Does not generate pwd and progname.
      */
-    explicit ArgParserTpl(std::string const &cline)
-        : cwd_(getcwd(nullptr, 0)), pwd_(""), progname_("") {
-        parse_(detail::split_clean(cline));
+    explicit ArgParserTpl(std::string_view cline)
+        : ArgParserTpl(cline, std::pmr::get_default_resource()) {}
+    /**@brief string constructor, allocate from `res`
+     *
+     * See the string constructor and the one from a memory resource.
+     */
+    ArgParserTpl(std::string_view cline, std::pmr::memory_resource *res)
+        : ArgParserTpl(res) {
+        detail::tokenizer tok(cline);
+        parse_(tok.begin(), tok.end());
+    }
+    /**@brief string constructor without cwd, pwd and progname
+     *
+     * See the string constructor and the one from fsc::no_paths.
+     */
+    ArgParserTpl(
+        std::string_view cline, no_paths_t,
+        std::pmr::memory_resource *res = std::pmr::get_default_resource())
+        : ArgParserTpl(no_paths, res) {
+        detail::tokenizer tok(cline);
+        parse_(tok.begin(), tok.end());
+    }
+    /**@brief construct from already split tokens
+     * @param first iterator to the first token
+     * @param last iterator past the last token
+     *
+     * The tokens can be anything that converts to std::string_view, e.g.
+     * `argv + 1, argv + argc` or a std::vector<std::string_view> that
+     * points into a buffer owned by the caller. The tokens are parsed in
+     * place, only keys and string values are copied into the ArgParser.
+     * Throws a std::runtime_error if the tokens are ill-formed.
+     * Does not generate pwd and progname.
+     */
+    template <typename It>
+    ArgParserTpl(It first, It last) {
+        parse_(first, last);
     }
     //------------------- const getter -------------------
     /**@brief get named argument if set
      * @param key is the name of the desired named argument
      *
      * If `key` is not found, a std::runtime_error is thrown.
+     * Keys are taken as std::string_view, i.e. neither a string literal nor
+     * a std::string is copied for the lookup.
      */
-    value_type const &operator[](std::string const &key) const {
-        if(n_args_.find(key) == n_args_.end())
-            throw std::runtime_error("ArgParser error: named argument '" + key +
-                                     "' not found");
-        return n_args_.at(key);
+    value_type const &operator[](std::string_view key) const {
+        auto const *val = keys_.find_named(key);
+        record_lookup_(key, val);
+        if(!val)
+            throw std::runtime_error("ArgParser error: named argument '" +
+                                     std::string(key) + "' not found");
+        return *val;
     }
     /**@brief get free argument if set
      * @param key position of the free argument
@@ -179,9 +347,11 @@ public:
      * a std::runtime_error is thrown.
      */
     template <typename T>
-    T get(std::string const &key, T const &def) const {
-        if(innamed_(key))
-            return n_args_.at(key);
+    T get(std::string_view key, T const &def) const {
+        auto const *val = keys_.find_named(key);
+        record_lookup_(key, val);
+        if(val)
+            return convert_<T>(key, *val);
         else
             return def;
     }
@@ -192,7 +362,7 @@ public:
      * If `key` is found but not convertibly to `std::string`,
      * a std::runtime_error is thrown.
      */
-    std::string get(std::string const &key, char const *def) const {
+    std::string get(std::string_view key, char const *def) const {
         return get<std::string>(key, def);
     }
     /**@brief get free argument if set, else a default
@@ -221,19 +391,82 @@ public:
     std::string get(size_type const &pos, char const *def) const {
         return get<std::string>(pos, def);
     }
+    /**@brief returns the handle of the key `key`
+     *
+     * The key is interned into a table of `this`, a handle can be used
+     * instead of the key with all accessors. It resolves by index to a
+     * cached pointer to the value, i.e. a hot loop does not look at the key
+     * again:
+     *
+     * `auto const dt = ap.handle("dt");`\n
+     * `for(...) x += v * ap.get(dt, 0.01);`
+     *
+     * The handle stays valid while `this` lives, whatever is parsed, set or
+     * merged, and can be used with copies of `this` that were made after
+     * it. A handle of a key that was interned after a copy throws a
+     * std::runtime_error if it is used with the other parser. Assigning
+     * another parser to `this` invalidates the handles of `this`, it
+     * accepts the handles of the other parser instead. The cache is
+     * refreshed once after keys were added or removed. Interning changes
+     * `this`, using a handle does not, i.e. handles can be used on a const
+     * parser from several threads at the same time.
+     */
+    key_handle handle(std::string_view key) { return handles_.intern(key); }
+    /**@brief returns the key of the handle `key`
+     */
+    std::string_view name(key_handle const &key) const {
+        return handles_.name(key);
+    }
+    /**@brief get named argument if set, see handle()
+     *
+     * If `key` is not set, a std::runtime_error is thrown.
+     */
+    value_type const &operator[](key_handle const &key) const {
+        auto const *val = lookup_(key).val;
+        record_lookup_(name(key), val);
+        if(!val)
+            throw std::runtime_error("ArgParser error: named argument '" +
+                                     std::string(name(key)) + "' not found");
+        return *val;
+    }
+    /**@brief get named argument if set, else a default, see handle()
+     */
+    template <typename T>
+    T get(key_handle const &key, T const &def) const {
+        auto const *val = lookup_(key).val;
+        record_lookup_(name(key), val);
+        if(val)
+            return convert_<T>(name(key), *val);
+        else
+            return def;
+    }
+    /**@brief special treatment of `char const *`, see handle()
+     */
+    std::string get(key_handle const &key, char const *def) const {
+        return get<std::string>(key, def);
+    }
     /**@brief returns the current working directory
      *
-     * the `cwd` should always be set
+     * Looked up with getcwd on the first call and cached, the first call
+     * may come from several threads at the same time. Throws a
+     * std::runtime_error if the parser was constructed with fsc::no_paths
+     * or getcwd fails.
      */
-    std::string const &cwd() const noexcept { return cwd_; }
+    std::string const &cwd() const {
+        auto const &res = paths_.cwd();
+        if(res.empty()) throw std::runtime_error("ArgParser error: cwd not set");
+        return res;
+    }
     /**@brief returns the program working directory
      *
      * Only works if the `pwd` is set, which only happens in the command
      * line constructor. If not set, a std::runtime_error is thrown.
+     * Computed on the first call, like cwd().
      */
     std::string const &pwd() const {
-        if(pwd_ == "") throw std::runtime_error("ArgParser error: pwd not set");
-        return pwd_;
+        auto const &res = paths_.pwd();
+        if(res.empty()) throw std::runtime_error("ArgParser error: pwd not set");
+        return res;
     }
     /**@brief returns the program name
      *
@@ -241,9 +474,10 @@ public:
      * command line constructor. If not set, a std::runtime_error is thrown.
      */
     std::string const &progname() const {
-        if(progname_ == "")
+        auto const &res = paths_.progname();
+        if(res.empty())
             throw std::runtime_error("ArgParser error: progname not set");
-        return progname_;
+        return res;
     }
     /**@brief returns the number of free arguments
      */
@@ -253,9 +487,12 @@ public:
      *
      * returns true if `key` is a flag or named argument. Note that it
      * is not allowed to have a flag and named argument with the same name.
+     * Only noexcept without instrumentation, recording may allocate.
      */
-    bool is_set(std::string const &key) const noexcept {
-        return inflag_(key) or innamed_(key);
+    bool is_set(std::string_view key) const noexcept(!IP::enabled) {
+        bool const res = inflag_(key) or innamed_(key);
+        record_lookup_(key, res);
+        return res;
     }
     /**@brief check if free argument is set
      * @param pos is the position of a potential free argument
@@ -265,6 +502,13 @@ public:
     bool is_set(size_type const &pos) const noexcept {
         return pos < freeargc();
     }
+    /**@brief check if flag or named argument is set, see handle()
+     */
+    bool is_set(key_handle const &key) const {
+        auto const e = lookup_(key);
+        record_lookup_(name(key), e.val or e.flag);
+        return e.val or e.flag;
+    }
     //------------------- modifier -------------------
     /**@brief set a named argument if not already set
      * @param key name of the named argument
@@ -275,9 +519,23 @@ public:
      * is thown.
      */
     template <typename T>
-    void def(std::string const &key, T const &def) {
-        if(!innamed_(key))
-            setnamed_(key, convert_to_value_type_(def, value_type()));
+    void def(std::string_view key, T const &def) {
+        findnamed_or_insert_(
+            key, [&]() { return convert_to_value_type_(def, value_type()); });
+    }
+    /**@brief set a named argument, replace it if already set
+     * @param key name of the named argument
+     * @param val is the new value of `key`
+     *
+     * Unlike merge, replacing a value does not warn. If there is already a
+     * flag with name `key` a std::runtime_error is thown.
+     */
+    template <typename T>
+    void set(std::string_view key, T const &val) {
+        auto v = convert_to_value_type_(val, value_type());
+        auto const res =
+            findnamed_or_insert_(key, [&]() { return std::move(v); });
+        if(!res.second) *res.first = std::move(v);
     }
     /**@brief set a flag
      * @param key name of the flag
@@ -285,9 +543,68 @@ public:
      * If there is already a named argument with name `key` a
      * std::runtime_error is thown.
      */
-    void def(std::string const &key) {  // for O3
+    void def(std::string_view key) {  // for O3
         setflag_(key);
     }
+    /**@brief set a named argument if not already set, see handle()
+     */
+    template <typename T>
+    void def(key_handle const &key, T const &def) {
+        if(!lookup_(key).val)
+            insertnamed_(name(key), convert_to_value_type_(def, value_type()));
+    }
+    /**@brief set a named argument, replace it if already set, see handle()
+     */
+    template <typename T>
+    void set(key_handle const &key, T const &val) {
+        set(name(key), val);
+    }
+    /**@brief report the warnings of `this` to `sink`
+     *
+     * `sink` has to outlive `this` and its copies, which report to it as
+     * well. By default the warnings go to fsc::diagnostics::global(). The
+     * warnings of a merge go to the diagnostics of the parser that is
+     * merged into.
+     */
+    void set_diagnostics(diagnostics &sink) noexcept { diag_ = &sink; }
+    /**@brief returns where the warnings of `this` go
+     */
+    diagnostics &get_diagnostics() const noexcept { return *diag_; }
+    /**@brief forget all arguments, but keep the memory
+     *
+     * Removes the named, flag and free arguments. The capacity of the
+     * containers, the buckets of fsc::hashed_keys and the key and token
+     * arenas are kept for the next parse. cwd, pwd and progname are kept.
+     */
+    void reset() {
+        handles_.touch();
+        keys_.clear();
+        f_args_.clear();
+        tokens_.clear();
+    }
+    /**@brief parse `cline` into `this` instead of the current arguments
+     * @param cline a string that simulates a command line
+     *
+     * The same as assigning `ArgParserTpl(cline)`, but reuses the memory of
+     * the previous parse, see reset(). Once the
+     * parser has seen a command line of similar size, parsing another one
+     * does not allocate with fsc::hashed_keys and fsc::lazy_poly_type (or
+     * fsc::poly_type without long string values). fsc::ordered_keys still
+     * allocates a node per key from the memory resource of the parser.
+     * Throws a std::runtime_error if the string is ill-formed, in which case
+     * `this` is empty.
+     */
+    void reparse(std::string_view cline) {
+        reset();
+        detail::tokenizer tok(cline, std::move(scratch_));
+        try {
+            parse_(tok.begin(), tok.end());
+        } catch(...) {
+            reset();
+            throw;
+        }
+        scratch_ = tok.release();
+    }
 
     /**@brief merge two argument parsers
      * @param rhs is the argument parser that is merged into `this` one.
@@ -306,74 +623,138 @@ public:
      * * cwd, pwd and progname are also overwritten by `rhs` if
      * `overwrite == true`, otherwise nothing is done.
      *
+     * The keys of both are merged as two sorted sequences (ordered_keys) or
+     * with one hash lookup per key (hashed_keys), i.e. in linear time.
+     * The collisions are checked before anything is merged, i.e. if a
+     * fsc::cat_on_your_keyboard_error is thrown, `this` is not changed.
      */
-    void merge(ArgParserTpl const &rhs, bool const &overwrite = true) noexcept {
-        //------------------- n_args_ -------------------
-        for(auto const &it : rhs.n_args_) {
-            std::string key = it.first;
-            value_type val = it.second;
-            setnamed_(key, val, overwrite);
-        }
+    void merge(ArgParserTpl const &rhs, bool const &overwrite = true) {
+        check_collisions_(rhs.keys_);
+        //------------------- n_args_ and flags_ -------------------
+        handles_.touch();
+        record_set_(rhs.keys_);
+        keys_.merge(rhs.keys_, overwrite, diag_type{diag_});
         //------------------- f_args_ -------------------
         if(overwrite) {
             f_args_ = rhs.f_args_;
         }
-        //------------------- flags_ -------------------
-        for(auto const &it : rhs.flags_) {
-            setflag_(it);
-        }
         //------------------- special member -------------------
+        if(overwrite and paths_.enabled() and rhs.paths_.enabled())
+            paths_ = rhs.paths_;
+    }
+    /**@brief merge an argument parser that is not needed anymore
+     * @param rhs is the argument parser that is merged into `this` one.
+     * @param overwrite defines the merging-behavior on conflicts
+     *
+     * Same as \link fsc::ArgParser::merge merge \endlink, but the keys and
+     * values of `rhs` are moved instead of copied (with ordered_keys, the
+     * nodes of new keys are spliced into `this` if both use the same
+     * memory resource). `rhs` is left empty.
+     * `this` may take over memory of `rhs`, i.e. if `rhs` allocates from a
+     * memory resource, it has to outlive `this` as well.
+     * Throws like the copying merge, in which case neither `this` nor `rhs`
+     * is changed.
+     */
+    void merge(ArgParserTpl &&rhs, bool const &overwrite = true) {
+        if(this == &rhs) return merge(static_cast<ArgParserTpl const &>(rhs),
+                                      overwrite);
+        check_collisions_(rhs.keys_);
+        //------------------- n_args_ and flags_ -------------------
+        tokens_.absorb(std::move(rhs.tokens_));  // lazy values refer to them
+        handles_.touch();
+        rhs.handles_.touch();
+        record_set_(rhs.keys_);
+        keys_.merge(std::move(rhs.keys_), overwrite, diag_type{diag_});
+        //------------------- f_args_ -------------------
         if(overwrite) {
-            cwd_ = rhs.cwd_;
-            pwd_ = rhs.pwd_;
-            progname_ = rhs.progname_;
+            f_args_ = std::move(rhs.f_args_);
         }
+        rhs.f_args_.clear();
+        //------------------- special member -------------------
+        if(overwrite and paths_.enabled() and rhs.paths_.enabled())
+            paths_ = std::move(rhs.paths_);
     }
     /**@brief read a file, parse the content and merge into `this`
      * @param filename is the name of the input file
      * @param overwrite defines the merging-behavior on conflicts
      *
-     * the file is loaded an parsed in a seperate ArgParser inastance an
-     * the merged into `this`. For the mergin behavior see \link
-     * fsc::ArgParser::merge merge \endlink.
+     * returns false if the file cannot be read. Large files are mapped
+     * into memory, split like the string constructor does and its tokens
+     * are parsed in place, the result is the same as merging an ArgParser of
+     * the file content. For the merging behavior see
+     * \link fsc::ArgParser::merge merge \endlink.
+     * Throws a std::runtime_error if the content is ill-formed or a key of
+     * the file is a flag of `this` or of the file (or the other way round), in
+     * which case `this` is not changed.
+     * A mapped file must not be truncated while it is parsed, that raises
+     * SIGBUS. Files that are rewritten by other processes are parsed with
+     * parse_file_buffered().
      */
     bool parse_file(std::string const &filename, bool const &overwrite = true) {
-        vec_type<std::string> arg;
-        std::ifstream ifs(filename, std::ios_base::in);
-        std::string res = "";
-        if(ifs.is_open()) {
-            std::stringstream buffer;
-            buffer << ifs.rdbuf();
-            res = buffer.str();
-            ifs.close();
-        } else
-            return false;
-
-        merge(ArgParserTpl(res), overwrite);
+        detail::mapped_file file;
+        if(!file.open(filename)) return false;
+        parse_content_(file.view(), overwrite);
+        return true;
+    }
+    /**@brief read a file into a buffer, parse the content and merge into
+     * `this`
+     *
+     * Same as parse_file(), but the file is never mapped, i.e. it is safe
+     * to parse a file that another process may truncate or rewrite at the
+     * same time.
+     */
+    bool parse_file_buffered(std::string const &filename,
+                             bool const &overwrite = true) {
+        detail::mapped_file file;
+        if(!file.read(filename)) return false;
+        parse_content_(file.view(), overwrite);
         return true;
     }
     //------------------- const fct -------------------
     /**@brief returns the map of the named arguments.
+     *
+     * The type of the map depends on the storage policy `SP`, it can be
+     * iterated as (key, value) pairs.
      */
-    map_type const &n_args() const { return n_args_; }
+    map_type const &n_args() const { return keys_.named(); }
+    /**@brief returns the flags.
+     *
+     * Iterable as keys, in the order they were set.
+     */
+    flag_type const &flags() const { return keys_.flags(); }
+    /**@brief returns an immutable snapshot of the arguments
+     *
+     * The snapshot does not refer to `this`, it stays valid if `this` is
+     * changed or destroyed. Its const members can be called from several
+     * threads at the same time, see fsc::FrozenArgParser.
+     * Values of a fsc::lazy_poly_type are classified on the way, i.e. for
+     * them this must not run while other threads read from `this`.
+     */
+    FrozenArgParser freeze() const {
+        return FrozenArgParser(keys_.named(), keys_.flags(), f_args_,
+                               paths_.cwd(), paths_.pwd(), paths_.progname());
+    }
 
     /**@brief prints the argument parser in a verbose form
      * @param os an std::ostream like object
+     *
+     * The cwd is looked up like cwd() does if it was not needed before,
+     * which allocates and takes a lock, i.e. printing is not noexcept.
      */
     template <typename S>
-    void print(S &os) const noexcept {
-        os << "=======ArgParser=======" << std::endl;
-        os << "free_args:" << std::endl;
-        for(auto const &it : f_args_) os << "    " << it << std::endl;
-        os << "named_args:" << std::endl;
-        for(auto const &it : n_args_)
-            os << "    " << it.first << " \t" << it.second << std::endl;
-        os << "flags:" << std::endl;
-        for(auto const &it : flags_) os << "    " << it << std::endl;
-        os << "special member:" << std::endl;
-        os << "    cwd \t" << cwd_ << std::endl;
-        os << "    pwd \t" << pwd_ << std::endl;
-        os << "    progname \t" << progname_;
+    void print(S &os) const {
+        os << "=======ArgParser=======\n";
+        os << "free_args:\n";
+        for(auto const &it : f_args_) os << "    " << it << '\n';
+        os << "named_args:\n";
+        for(auto const &it : keys_.named())
+            os << "    " << it.first << " \t" << it.second << '\n';
+        os << "flags:\n";
+        for(auto const &it : keys_.flags()) os << "    " << it << '\n';
+        os << "special member:\n";
+        os << "    cwd \t" << paths_.cwd() << '\n';
+        os << "    pwd \t" << paths_.pwd() << '\n';
+        os << "    progname \t" << paths_.progname();
     }
 
 private:
@@ -389,118 +770,299 @@ private:
         named_mm_eq,
         invalid
     };
-    inline bool inflag_(std::string const &flag) const noexcept {
-        return std::find(flags_.begin(), flags_.end(), flag) != flags_.end();
+    inline bool inflag_(std::string_view flag) const noexcept {
+        return keys_.has_flag(flag);
     }
-    inline bool innamed_(std::string const &key) const noexcept {
-        return n_args_.find(key) != n_args_.end();
+    inline bool innamed_(std::string_view key) const noexcept {
+        return keys_.find_named(key) != nullptr;
     }
-    void setflag_(std::string const &flag) {
-        if(inflag_(flag))
-            std::cout << "ArgParser warning: setting flag '" << flag
-                      << "' for a second time has no effect" << std::endl;
-        else {
-            if(innamed_(flag))
-                throw cat_on_your_keyboard_error(
-                    "ArgParser error: there cannot be a flag and named "
-                    "argument with the same name '" +
-                    flag + "'");
-            flags_.push_back(flag);
+    // the instrumentation, nothing of it is compiled with uninstrumented
+    void record_lookup_(std::string_view key, bool const &found) const {
+        if constexpr(IP::enabled) access_stats::global().lookup(key, found);
+    }
+    void record_set_(std::string_view key) const {
+        if constexpr(IP::enabled) access_stats::global().set(key);
+    }
+    void record_set_(store_type const &keys) const {
+        if constexpr(IP::enabled) {
+            for(auto const &it : keys.named()) record_set_(it.first);
+            for(auto const &it : keys.flags()) record_set_(it);
         }
     }
     template <typename T>
-    void setnamed_(std::string const &key, T const &val,
-                   bool const &overwrite = true) {
-        if(innamed_(key)) {
-            if(overwrite) {
-                std::cout << "ArgParser warning: named argument '" << key
-                          << "' is overwritten (" << n_args_[key] << " -> "
-                          << val << ")" << std::endl;
-                n_args_[key] = val;
+    T convert_(std::string_view key, value_type const &val) const {
+        if constexpr(!IP::enabled)
+            return val;
+        else {
+            using clock = std::chrono::steady_clock;
+            auto const start = clock::now();
+            auto const ns = [&start]() {
+                return std::uint64_t(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        clock::now() - start)
+                        .count());
+            };
+            try {
+                T res = val;
+                access_stats::global().conversion(key, ns(), false);
+                return res;
+            } catch(...) {
+                access_stats::global().conversion(key, ns(), true);
+                throw;
             }
-        } else {
-            if(inflag_(key))
-                throw cat_on_your_keyboard_error(
-                    "ArgParser error: there cannot be a flag and named "
-                    "argument with the same name '" +
-                    key + "'");
-            n_args_[key] = val;
         }
     }
-    arg_type find_type_(vec_type<std::string> const &arg,
-                        uint const &idx) const {
-        if(idx >= arg.size()) return invalid;
-
-        if(arg[idx][0] == '-') {  // flag_m, flag_mm, named_m_stick, named_m,
-                                  // named_mm, named_m_eq, named_mm_eq
-            if(arg[idx][1] == '-') {  // flag_mm, named_mm, named_mm_eq
-                if(arg[idx].find("=") != std::string::npos)
-                    return named_mm_eq;
-                else if(find_type_(arg, idx + 1) == free)
-                    return named_mm;
-                else
-                    return flag_mm;
+    /* parses the content directly into `this`, like merging an ArgParser of
+     * the content would. A first pass only checks the tokens, i.e. `this`
+     * is not changed if the content is ill-formed or a key clashes with a
+     * flag. Only the flags of the file and (if !overwrite) the keys `this`
+     * keeps are copied, a second check of the named keys is made if the
+     * file has flags at all.
+     */
+    void parse_content_(std::string_view content, bool const &overwrite) {
+        detail::key_arena copies;
+        detail::flat_hash_set file_flags, kept;
+        struct check_hook {
+            ArgParserTpl const *self;
+            detail::key_arena *copies;
+            detail::flat_hash_set *file_flags, *kept;
+            bool overwrite;
+            bool named(std::string_view key, std::string_view) const {
+                if(self->inflag_(key)) diag_type{self->diag_}.collision(key);
+                if(!overwrite and self->innamed_(key) and !kept->count(key))
+                    kept->insert(copies->store(key));
+                return true;
+            }
+            bool flag(std::string_view key) const {
+                if(self->innamed_(key)) diag_type{self->diag_}.collision(key);
+                if(!file_flags->count(key))
+                    file_flags->insert(copies->store(key));
+                return true;
+            }
+            bool is_flag(std::string_view) const noexcept { return false; }
+            bool free_arg(std::string_view) const noexcept { return true; }
+        };
+        struct file_flag_hook : no_hook_ {
+            detail::flat_hash_set const *file_flags;
+            bool named(std::string_view key, std::string_view) const {
+                if(file_flags->count(key)) diag_type{nullptr}.collision(key);
+                return true;
             }
-            if(arg[idx].size() == 2) {  // flag_m, named_m
-                if(find_type_(arg, idx + 1) == free)
-                    return named_m;
-                else
-                    return flag_m;
-            } else {  // named_m_stick, named_m_eq
-                if(arg[idx][2] == '=')
-                    return named_m_eq;
-                else
-                    return named_m_stick;
+            bool flag(std::string_view) const noexcept { return true; }
+            bool free_arg(std::string_view) const noexcept { return true; }
+        };
+        struct insert_hook : no_hook_ {
+            detail::flat_hash_set const *kept;
+            bool overwrite;
+            bool named(std::string_view key, std::string_view) const {
+                return kept->count(key) != 0;
             }
+            bool free_arg(std::string_view) const noexcept {
+                return !overwrite;
+            }
+        };
 
-        } else {                                         // free or named_eq
-            if(arg[idx].find("=") != std::string::npos)  // named_eq
-                return named_eq;
+        std::string buf;  // reused by the passes
+        auto const pass = [&](auto const &hook) {
+            detail::tokenizer tok(content, std::move(buf));
+            parse_(tok.begin(), tok.end(), hook);
+            buf = tok.release();
+        };
+        pass(check_hook{this, &copies, &file_flags, &kept, overwrite});
+        if(!file_flags.empty()) pass(file_flag_hook{{}, &file_flags});
 
-            return free;
+        if(overwrite) {
+            f_args_.clear();
+            if(paths_.enabled()) paths_ = detail::process_paths();
+        }
+        pass(insert_hook{{}, &kept, overwrite});
+    }
+    // the cached lookup of a handle, see detail::key_interner
+    auto lookup_(key_handle const &key) const {
+        return handles_.lookup(
+            key, [this](std::string_view name, auto &val, bool &flag) {
+                val = keys_.find_named(name);
+                flag = !val and inflag_(name);
+            });
+    }
+    // what is reported while setting arguments, also used by the stores
+    // when merging
+    struct diag_type {
+        diagnostics *sink;
+        void overwrite(std::string_view key, value_type const &old,
+                       value_type const &val) const {
+            sink->overwrite(key, old, val);
         }
+        void flag_twice(std::string_view flag) const {
+            sink->flag_twice(flag);
+        }
+        [[noreturn]] void collision(std::string_view key) const {
+            throw cat_on_your_keyboard_error(
+                "ArgParser error: there cannot be a flag and named "
+                "argument with the same name '" +
+                std::string(key) + "'");
+        }
+    };
+    // throws if a key of `keys` is a flag of `this` or the other way round
+    void check_collisions_(store_type const &keys) const {
+        for(auto const &it : keys.named())
+            if(inflag_(it.first)) diag_type{diag_}.collision(it.first);
+        for(auto const &it : keys.flags())
+            if(innamed_(it)) diag_type{diag_}.collision(it);
     }
-    void parse_(vec_type<std::string> const &arg) {
-        for(uint i = 0; i < arg.size(); ++i) {
-            auto t = find_type_(arg, i);
+    void setflag_(std::string_view flag) {
+        if(inflag_(flag))
+            diag_type{diag_}.flag_twice(flag);
+        else {
+            if(innamed_(flag)) diag_type{diag_}.collision(flag);
+            handles_.touch();
+            record_set_(flag);
+            keys_.insert_flag(flag);
+        }
+    }
+    void setnamed_(std::string_view key, value_type val,
+                   bool const &overwrite = true) {
+        auto const res =
+            findnamed_or_insert_(key, [&]() { return std::move(val); });
+        if(!res.second and overwrite) {
+            diag_type{diag_}.overwrite(key, *res.first, val);
+            *res.first = std::move(val);
+        }
+    }
+    // a single lookup of `key`, make() is only called (and `key` checked
+    // against the flags) if `key` is not a named argument yet
+    template <typename Make>
+    std::pair<value_type *, bool> findnamed_or_insert_(std::string_view key,
+                                                       Make const &make) {
+        auto const res = keys_.find_or_insert_named(key, [&]() {
+            if(inflag_(key)) diag_type{diag_}.collision(key);
+            return make();
+        });
+        if(res.second) {
+            handles_.touch();
+            record_set_(key);
+        }
+        return res;
+    }
+    // key must not be a named argument yet
+    void insertnamed_(std::string_view key, value_type val) {
+        if(inflag_(key)) diag_type{diag_}.collision(key);
+        handles_.touch();
+        record_set_(key);
+        keys_.insert_named(key, std::move(val));
+    }
+    /* classifies a single token without looking at its neighbours.
+     * A token that is either a flag or a named argument is reported as
+     * flag_m/flag_mm, parse_ decides with one token lookahead.
+     */
+    arg_type find_type_(std::string_view arg) const noexcept {
+        if(arg.size() > 1 and arg[0] == '-') {
+            if(arg[1] == '-') {  // flag_mm, named_mm, named_mm_eq
+                if(arg.find('=') != std::string_view::npos)
+                    return named_mm_eq;
+                return flag_mm;
+            }
+            if(arg.size() == 2)  // flag_m, named_m
+                return flag_m;
+            if(arg[2] == '=')  // named_m_stick, named_m_eq
+                return named_m_eq;
+            return named_m_stick;
+        }
+        // free or named_eq
+        if(arg.find('=') != std::string_view::npos) return named_eq;
+        return free;
+    }
+    /* the tokens are only looked at through std::string_view, i.e. It can
+     * be char ** (argv), an iterator to std::string(_view) or a
+     * detail::tokenizer::iterator. A single pass is made over the tokens,
+     * a token stays valid while the next one is looked at.
+     */
+    template <typename It>
+    void parse_(It first, It const last) {
+        parse_(first, last, no_hook_());
+    }
+    // a hook sees every named argument (with its raw value), flag and free
+    // argument first and returns true if it took it. is_flag() returns true
+    // for keys that the hook knows to be flags, they are not followed by a
+    // value, see ArgSpecTpl
+    struct no_hook_ {
+        bool named(std::string_view, std::string_view) const noexcept {
+            return false;
+        }
+        bool flag(std::string_view) const noexcept { return false; }
+        bool is_flag(std::string_view) const noexcept { return false; }
+        bool free_arg(std::string_view) const noexcept { return false; }
+    };
+    template <typename It, typename Hook>
+    void parse_(It first, It const last, Hook const &hook) {
+        auto const named = [&](std::string_view key, std::string_view raw) {
+            if(!hook.named(key, raw))
+                setnamed_(key, str_to_type_(raw, value_type()));
+        };
+
+        // every token is classified exactly once: `next` holds the type of
+        // the token after `arg` and is shifted into `t` in the next
+        // iteration
+        std::string_view ntok;
+        arg_type next = invalid;
+        auto const advance = [&]() {
+            ++first;
+            if(first != last) {
+                ntok = *first;
+                next = find_type_(ntok);
+            } else
+                next = invalid;
+        };
+        if(first != last) {
+            ntok = *first;
+            next = find_type_(ntok);
+        }
+        while(first != last) {
+            auto t = next;
+            std::string_view arg = ntok;
+            advance();
+
+            // a flag followed by a free argument is a named argument,
+            // unless the hook knows it is a flag
+            if(next == free) {
+                if(t == flag_m and !hook.is_flag(arg.substr(1))) t = named_m;
+                if(t == flag_mm and !hook.is_flag(arg.substr(2))) t = named_mm;
+            }
 
-            std::string arg1 = arg[i];
-            std::string help = "";
-            uint64_t pos;
+            std::string_view::size_type pos;
 
             switch(t) {
                 case(named_m_stick):
-                    help.push_back(arg1[1]);
-                    arg1.erase(0, 2);
-                    setnamed_(help, str_to_type_(value_type(arg1)));
-                    arg1 = help;
+                    named(arg.substr(1, 1), arg.substr(2));
                     break;
                 case(named_mm):
-                    arg1.erase(0, 1);
+                    arg.remove_prefix(1);
+                    // fall through
                 case(named_m):
-                    arg1.erase(0, 1);
-                    setnamed_(arg1, str_to_type_(value_type(arg[i + 1])));
-                    ++i;
+                    arg.remove_prefix(1);
+                    named(arg, ntok);
+                    advance();
                     break;
                 case(named_mm_eq):
-                    arg1.erase(0, 1);
+                    arg.remove_prefix(1);
+                    // fall through
                 case(named_m_eq):
-                    arg1.erase(0, 1);
+                    arg.remove_prefix(1);
+                    // fall through
                 case(named_eq):
-                    pos = arg1.find("=");
-                    help = arg1;
-                    help.erase(0, pos + 1);
-                    arg1.erase(pos, arg1.size());
-                    setnamed_(arg1, str_to_type_(value_type(help)));
+                    pos = arg.find('=');
+                    named(arg.substr(0, pos), arg.substr(pos + 1));
                     break;
                 case(free):
-                    f_args_.push_back(str_to_type_(value_type(arg1)));
+                    if(!hook.free_arg(arg))
+                        f_args_.push_back(str_to_type_(arg, value_type()));
                     break;
                 case(flag_mm):
-                    arg1.erase(0, 1);
+                    arg.remove_prefix(1);
+                    // fall through
                 case(flag_m):
-                    arg1.erase(0, 1);
-                    setflag_(arg1);
+                    arg.remove_prefix(1);
+                    if(!hook.flag(arg)) setflag_(arg);
                     break;
                 default:
                     break;
@@ -508,55 +1070,53 @@ private:
         }
     }
     // methods for string
-    std::string const &str_to_type_(std::string const &a) { return a; }
+    std::string str_to_type_(std::string_view a, std::string const &) {
+        return std::string(a);
+    }
     template <typename T>
     std::string convert_to_value_type_(T const &val, std::string const &) {
         return fsc::to_string(val);
     }
     // methods for polytype
-    poly_type str_to_type_(poly_type const &a) {
-        std::string val = a;
-
-        size_t ipos = 0;
-        int ival = 0;
-        try {
-            ival = std::stoi(val, &ipos);
-        } catch(...) {
+    poly_type str_to_type_(std::string_view a, poly_type const &) {
+        auto const num = detail::classify_number(a);
+        switch(num.kind) {
+            case(detail::number_token::integer):
+                return poly_type(num.i);
+            case(detail::number_token::floating):
+                return poly_type(num.d);
+            default:  // the only case that copies the token
+                return poly_type(std::string(a));
         }
-
-        size_t dpos = 0;
-        double dval = 0;
-        try {
-            dval = std::stod(val, &dpos);
-            return poly_type(dval);
-        } catch(...) {
-        }
-
-        if(ipos == val.size())
-            return poly_type(ival);
-        else if(dpos == val.size())
-            return poly_type(dval);
-        else
-            return poly_type(val);
     }
     template <typename T>
     poly_type convert_to_value_type_(T const &val, poly_type const &) {
         return poly_type(val);
     }
+    // methods for lazy_poly_type
+    lazy_poly_type str_to_type_(std::string_view a, lazy_poly_type const &) {
+        return lazy_poly_type::from_token(tokens_.store(a));
+    }
+    template <typename T>
+    lazy_poly_type convert_to_value_type_(T const &val,
+                                          lazy_poly_type const &) {
+        return poly_type(val);
+    }
 
 private:
-    map_type n_args_;
+    store_type keys_;  // named arguments and flags
     vec_type<value_type> f_args_;
-    vec_type<std::string> flags_;
-    std::string cwd_;
-    std::string pwd_;
-    std::string progname_;
+    detail::token_arena tokens_;  // raw tokens of lazy_poly_type values
+    detail::process_paths paths_;  // cwd, pwd and progname
+    diagnostics *diag_ = &diagnostics::global();
+    std::string scratch_;  // the tokenizer buffer of reparse(), empty
+    detail::key_interner<value_type> handles_;  // see handle()
 };
 /**@brief stream operator for the argument parser
  */
-template <typename value_type>
+template <typename value_type, typename SP, typename IP>
 std::ostream &operator<<(std::ostream &os,
-                         ArgParserTpl<value_type> const &arg) {
+                         ArgParserTpl<value_type, SP, IP> const &arg) {
     arg.print(os);
     return os;
 }
@@ -568,14 +1128,14 @@ using ArgParser = ArgParserTpl<>;
 /// it does not exist.
 /// \returns Eighter the value to the key if it exists, and the default
 /// value otherwise.
-template <typename value_type>
-value_type const &get(
-    ArgParserTpl<value_type> const
+template <typename value_type, typename SP, typename IP>
+value_type get(
+    ArgParserTpl<value_type, SP, IP> const
         &ap  ///< the map we want to get the element from
     ,
-    std::string const &key  ///< the key in question
+    std::string_view key  ///< the key in question
     ,
-    typename ArgParserTpl<value_type>::value_type const
+    typename ArgParserTpl<value_type, SP, IP>::value_type const
         &value  ///< return this value if the map does not contain the key
     ) noexcept {
     return ap.get(key, value);
@@ -0,0 +1,166 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    access_stats.hpp
+
+#ifndef FSC_ACCESS_STATS_HEADER
+#define FSC_ACCESS_STATS_HEADER
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fsc {
+/** @brief what the instrumented parsers of a process did with their keys
+ *
+ * Parsers with the fsc::instrumented policy record into global():
+ *
+ * * every lookup of a named argument or flag by `operator[]`, `get` and
+ *   `is_set` (by key or by fsc::key_handle), and how many of them missed,
+ * * every failed cast of a value in `get`,
+ * * the time spent converting values in `get`,
+ * * every key that was set, i.e. keys that are never looked up show up as
+ *   unused.
+ *
+ * `fsc::access_stats::global().report_at_exit();  // to std::cerr`\n
+ * `fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys, fsc::instrumented>
+ * ap(argc, argv);`
+ *
+ * Recording takes a lock, the stats can be shared by parsers in several
+ * threads.
+ */
+class access_stats {
+public:
+    /// the record of one key
+    struct key_stats {
+        std::uint64_t lookups = 0;        ///< by operator[], get and is_set
+        std::uint64_t misses = 0;         ///< lookups of a key that was not set
+        std::uint64_t cast_failures = 0;  ///< conversions in get that threw
+        std::uint64_t conversion_ns = 0;  ///< time of the conversions in get
+        bool set = false;                 ///< was set in a parser
+    };
+    using map_type = std::map<std::string, key_stats, std::less<>>;
+
+    //------------------- structors -------------------
+    access_stats() = default;
+    access_stats(access_stats const &) = delete;
+    access_stats &operator=(access_stats const &) = delete;
+    /// prints the report if report_at_exit() was called
+    ~access_stats() {
+        if(exit_os_) report(*exit_os_);
+    }
+
+    /**@brief the stats of all instrumented parsers
+     */
+    static access_stats &global() noexcept {
+        static access_stats res;
+        return res;
+    }
+
+    //------------------- const fct -------------------
+    /**@brief returns a copy of the records, sorted by key
+     */
+    map_type keys() const {
+        std::lock_guard<std::mutex> lock(m_);
+        return keys_;
+    }
+    /**@brief writes the report to `os`
+     *
+     * The keys that were looked up, most lookups first, then the keys that
+     * were set but never looked up.
+     */
+    void report(std::ostream &os = std::cerr) const {
+        auto const all = keys();
+        std::vector<std::pair<std::string_view, key_stats>> used;
+        for(auto const &it : all)
+            if(it.second.lookups) used.emplace_back(it.first, it.second);
+        std::stable_sort(used.begin(), used.end(),
+                         [](auto const &a, auto const &b) {
+                             return a.second.lookups > b.second.lookups;
+                         });
+        os << "=======ArgParser access=======\n";
+        os << "used (lookups misses cast_failures conversion_ns):\n";
+        for(auto const &it : used) {
+            os << "    " << it.first << " \t" << it.second.lookups << ' '
+               << it.second.misses << ' ' << it.second.cast_failures << ' '
+               << it.second.conversion_ns << '\n';
+        }
+        os << "unused:\n";
+        for(auto const &it : all)
+            if(it.second.set and !it.second.lookups)
+                os << "    " << it.first << '\n';
+        os.flush();
+    }
+
+    //------------------- modifier -------------------
+    /**@brief write the report to `os` when the program exits
+     *
+     * `os` has to be alive at exit, e.g. std::cerr or std::cout.
+     */
+    void report_at_exit(std::ostream &os = std::cerr) noexcept {
+        exit_os_ = &os;
+    }
+    /**@brief forgets all records
+     */
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_);
+        keys_.clear();
+    }
+
+    /// @cond NEVER_DOCUMENT_THIS_ENTITY
+    // called by the instrumented parsers
+    void lookup(std::string_view key, bool const &found) {
+        std::lock_guard<std::mutex> lock(m_);
+        auto &k = at_(key);
+        ++k.lookups;
+        if(!found) ++k.misses;
+    }
+    void set(std::string_view key) {
+        std::lock_guard<std::mutex> lock(m_);
+        at_(key).set = true;
+    }
+    void conversion(std::string_view key, std::uint64_t const &ns,
+                    bool const &failed) {
+        std::lock_guard<std::mutex> lock(m_);
+        auto &k = at_(key);
+        k.conversion_ns += ns;
+        if(failed) ++k.cast_failures;
+    }
+    /// @endcond
+
+private:
+    key_stats &at_(std::string_view key) {
+        auto it = keys_.find(key);
+        if(it == keys_.end()) it = keys_.emplace(key, key_stats()).first;
+        return it->second;
+    }
+
+    mutable std::mutex m_;
+    map_type keys_;
+    std::ostream *exit_os_ = nullptr;
+};
+
+/** @brief default instrumentation policy of fsc::ArgParserTpl, nothing is
+ * recorded and nothing is compiled in
+ */
+struct uninstrumented {
+    static constexpr bool enabled = false;
+};
+/** @brief instrumentation policy of fsc::ArgParserTpl that records the
+ * accesses to fsc::access_stats::global()
+ *
+ * `fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys, fsc::instrumented>
+ * ap(argc, argv);`
+ */
+struct instrumented {
+    static constexpr bool enabled = true;
+};
+}  // end namespace fsc
+
+#endif  // FSC_ACCESS_STATS_HEADER
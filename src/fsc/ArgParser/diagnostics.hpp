@@ -0,0 +1,179 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    diagnostics.hpp
+
+#ifndef FSC_DIAGNOSTICS_HEADER
+#define FSC_DIAGNOSTICS_HEADER
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace fsc {
+/** @brief a warning of an ArgParser, see fsc::diagnostics
+ */
+struct diag_event {
+    enum kind_type {
+        overwrite,  ///< a named argument is overwritten
+        flag_twice  ///< a flag is set for a second time
+    };
+    kind_type kind;
+    std::string_view key;   ///< only valid during the report
+    std::string old_value;  ///< the overwritten value, empty for flags
+    std::string new_value;  ///< the new value, empty for flags
+
+    /// the text of the warning, without newline
+    std::string message() const {
+        if(kind == flag_twice)
+            return "ArgParser warning: setting flag '" + std::string(key) +
+                   "' for a second time has no effect";
+        return "ArgParser warning: named argument '" + std::string(key) +
+               "' is overwritten (" + old_value + " -> " + new_value + ")";
+    }
+};
+
+/** @brief where the warnings of an ArgParser go
+ *
+ * A named argument that is overwritten and a flag that is set twice are
+ * not errors, but reported to the diagnostics of the parser:
+ *
+ * * `print` writes the warning to a std::ostream (std::cout by default)
+ *   with `'\n'`, i.e. the stream is not flushed per warning.
+ * * `silent` ignores the warnings.
+ * * `counters` only counts them, see count().
+ * * `buffered` collects the text of the warnings, see take() and flush().
+ * * `callback` calls a function with the fsc::diag_event.
+ *
+ * All modes but `silent` count. Parsers report to diagnostics::global()
+ * (printing to std::cout) unless they are given their own:
+ *
+ * `fsc::diagnostics diag(fsc::diagnostics::buffered);`\n
+ * `ap.set_diagnostics(diag);`\n
+ * `ap.merge(other);  // overwrites go to diag`
+ *
+ * A diagnostics object can be shared by parsers in several threads, the
+ * mode must not be changed while parsers report to it.
+ */
+class diagnostics {
+public:
+    enum mode_type { print, silent, counters, buffered, callback };
+    using callback_type = std::function<void(diag_event const &)>;
+
+    //------------------- structors -------------------
+    /**@brief print to `os`, which has to outlive `this`
+     */
+    explicit diagnostics(std::ostream &os = std::cout) noexcept
+        : mode_(print), os_(&os) {}
+    /**@brief `silent`, `counters` or `buffered`, print to std::cout for
+     * `print`
+     */
+    explicit diagnostics(mode_type const &mode) noexcept
+        : mode_(mode == callback ? silent : mode), os_(&std::cout) {}
+    /**@brief call `f` for every warning
+     */
+    explicit diagnostics(callback_type f)
+        : mode_(callback), os_(&std::cout), f_(std::move(f)) {}
+    diagnostics(diagnostics const &) = delete;
+    diagnostics &operator=(diagnostics const &) = delete;
+
+    /**@brief the diagnostics of all parsers that have no own ones
+     *
+     * Prints to std::cout. Can be switched with mode(), e.g.
+     * `fsc::diagnostics::global().mode(fsc::diagnostics::silent);`
+     */
+    static diagnostics &global() noexcept {
+        static diagnostics res;
+        return res;
+    }
+
+    //------------------- const fct -------------------
+    mode_type mode() const noexcept { return mode_; }
+    /**@brief returns the number of warnings of kind `kind`
+     */
+    std::uint64_t count(diag_event::kind_type const &kind) const noexcept {
+        return counts_[kind];
+    }
+
+    //------------------- modifier -------------------
+    /**@brief switch to `silent`, `counters`, `buffered` or `print`
+     *
+     * `print` keeps the stream. The counters and the buffer are kept.
+     */
+    void mode(mode_type const &mode) noexcept {
+        if(mode != callback) mode_ = mode;
+    }
+    /**@brief returns the buffered warnings, one per line, and clears them
+     */
+    std::string take() {
+        std::lock_guard<std::mutex> lock(m_);
+        std::string res;
+        res.swap(buffer_);
+        return res;
+    }
+    /**@brief writes the buffered warnings to `os` and clears them
+     */
+    void flush(std::ostream &os = std::cout) {
+        os << take();
+        os.flush();
+    }
+    /**@brief resets the counters to zero
+     */
+    void reset_counts() noexcept {
+        for(auto &c : counts_) c = 0;
+    }
+
+    /// @cond NEVER_DOCUMENT_THIS_ENTITY
+    // called by the parsers, the values are only formatted if needed
+    template <typename V>
+    void overwrite(std::string_view key, V const &old, V const &val) {
+        if(mode_ == silent) return;
+        ++counts_[diag_event::overwrite];
+        if(mode_ == counters) return;
+        if(mode_ == print) {  // without formatting into strings first
+            std::lock_guard<std::mutex> lock(m_);
+            *os_ << "ArgParser warning: named argument '" << key
+                 << "' is overwritten (" << old << " -> " << val << ")\n";
+            return;
+        }
+        report_(diag_event{diag_event::overwrite, key, str_(old), str_(val)});
+    }
+    void flag_twice(std::string_view key) {
+        if(mode_ == silent) return;
+        ++counts_[diag_event::flag_twice];
+        if(mode_ == counters) return;
+        report_(diag_event{diag_event::flag_twice, key, "", ""});
+    }
+    /// @endcond
+
+private:
+    template <typename V>
+    static std::string str_(V const &val) {
+        std::ostringstream ss;
+        ss << val;
+        return ss.str();
+    }
+    void report_(diag_event const &ev) {
+        std::lock_guard<std::mutex> lock(m_);
+        if(mode_ == callback)
+            f_(ev);
+        else if(mode_ == buffered)
+            (buffer_ += ev.message()) += '\n';
+        else
+            *os_ << ev.message() << '\n';
+    }
+
+    mode_type mode_;
+    std::ostream *os_;
+    callback_type f_;
+    std::atomic<std::uint64_t> counts_[2] = {};
+    std::mutex m_;
+    std::string buffer_;
+};
+}  // end namespace fsc
+
+#endif  // FSC_DIAGNOSTICS_HEADER
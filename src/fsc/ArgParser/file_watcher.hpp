@@ -0,0 +1,169 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    file_watcher.hpp
+
+#ifndef FSC_FILE_WATCHER_HEADER
+#define FSC_FILE_WATCHER_HEADER
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace fsc {
+namespace detail {
+    /** @brief blocks until a file might have changed
+     *
+     * On Linux the directory of the file is watched with inotify, a change
+     * is reported once the file was closed after writing or another file
+     * was renamed onto it (which is what most editors do). Everywhere else,
+     * or if inotify is not available, the mtime, size and inode of the file
+     * are polled every `interval`, a change is only reported once the stamp
+     * held steady for two polls, i.e. a file that is still being written is
+     * not reported. The poll also runs with inotify as a safety net, e.g.
+     * if the directory is replaced.
+     *
+     * wait() is called by one thread, stop() may be called from any other.
+     */
+    class file_watcher {
+    public:
+        file_watcher(std::string filename, std::chrono::milliseconds interval)
+            : filename_(std::move(filename)), interval_(interval) {
+            if(::pipe(wake_) != 0) wake_[0] = wake_[1] = -1;
+            for(int fd : wake_)
+                if(fd >= 0) ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+            auto const pos = filename_.rfind('/');
+            auto const dir = pos == std::string::npos
+                                 ? std::string(".")
+                                 : filename_.substr(0, pos + 1);
+            name_ = pos == std::string::npos ? filename_
+                                              : filename_.substr(pos + 1);
+#ifdef __linux__
+            inotify_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if(inotify_ >= 0 and
+               ::inotify_add_watch(inotify_, dir.c_str(),
+                                   IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+                ::close(inotify_);
+                inotify_ = -1;
+            }
+#endif
+            stamp_ = stamp_of_();
+        }
+        file_watcher(file_watcher const &) = delete;
+        file_watcher &operator=(file_watcher const &) = delete;
+        ~file_watcher() {
+            for(int fd : {wake_[0], wake_[1], inotify_})
+                if(fd >= 0) ::close(fd);
+        }
+
+        /// returns true if the file might have changed, false after stop()
+        bool wait() {
+            while(true) {
+                pollfd fds[2] = {{wake_[0], POLLIN, 0}, {inotify_, POLLIN, 0}};
+                int const n = ::poll(fds, inotify_ >= 0 ? 2 : 1,
+                                     int(interval_.count()));
+                if(n < 0) continue;  // EINTR
+                if(stop_) return false;
+                if(n > 0) {
+                    if(!(fds[1].revents and inotify_ >= 0 and
+                         drain_events_()))
+                        continue;  // about another file of the directory
+                    stamp_ = stamp_of_();
+                    pending_ = false;
+                    return true;
+                }
+                // timeout, the poll
+                auto const stamp = stamp_of_();
+                if(stamp == stamp_)
+                    pending_ = false;
+                else if(pending_ and stamp == candidate_) {
+                    stamp_ = stamp;
+                    pending_ = false;
+                    return true;
+                } else {
+                    candidate_ = stamp;
+                    pending_ = true;
+                }
+            }
+        }
+        /// wakes up wait(), which returns false from now on
+        void stop() noexcept {
+            stop_ = true;
+            char const c = 0;
+            if(wake_[1] >= 0 and ::write(wake_[1], &c, 1) < 0) {
+            }  // without the pipe wait() sees stop_ after `interval`
+        }
+        /// true if inotify is used, false if the file is polled
+        bool notified() const noexcept { return inotify_ >= 0; }
+
+    private:
+        struct stamp {
+            bool exists = false;
+            long long sec = 0;
+            long long nsec = 0;
+            long long size = 0;
+            unsigned long long ino = 0;
+            bool operator==(stamp const &rhs) const noexcept {
+                return exists == rhs.exists and sec == rhs.sec and
+                       nsec == rhs.nsec and size == rhs.size and
+                       ino == rhs.ino;
+            }
+        };
+        stamp stamp_of_() const noexcept {
+            stamp res;
+            struct stat st;
+            if(::stat(filename_.c_str(), &st) != 0) return res;
+            res.exists = true;
+#ifdef __APPLE__
+            res.sec = st.st_mtimespec.tv_sec;
+            res.nsec = st.st_mtimespec.tv_nsec;
+#else
+            res.sec = st.st_mtim.tv_sec;
+            res.nsec = st.st_mtim.tv_nsec;
+#endif
+            res.size = st.st_size;
+            res.ino = st.st_ino;
+            return res;
+        }
+        // true if one of the pending events is about our file
+        bool drain_events_() noexcept {
+            bool res = false;
+#ifdef __linux__
+            alignas(inotify_event) char buf[4096];
+            while(true) {
+                auto const n = ::read(inotify_, buf, sizeof(buf));
+                if(n <= 0) break;
+                for(char *p = buf; p < buf + n;) {
+                    auto const *ev = reinterpret_cast<inotify_event *>(p);
+                    if(ev->len and std::strcmp(ev->name, name_.c_str()) == 0)
+                        res = true;
+                    p += sizeof(inotify_event) + ev->len;
+                }
+            }
+#endif
+            return res;
+        }
+
+        std::string filename_;
+        std::string name_;  // without the directory
+        std::chrono::milliseconds interval_;
+        int wake_[2] = {-1, -1};
+        int inotify_ = -1;
+        std::atomic<bool> stop_{false};
+        stamp stamp_;      // of the last reported change
+        stamp candidate_;  // differs from stamp_, if it holds it is reported
+        bool pending_ = false;
+    };
+}  // end namespace detail
+}  // end namespace fsc
+/// \endcond
+
+#endif  // FSC_FILE_WATCHER_HEADER
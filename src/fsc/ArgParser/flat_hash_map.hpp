@@ -0,0 +1,361 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    flat_hash_map.hpp
+
+#ifndef FSC_FLAT_HASH_MAP_HEADER
+#define FSC_FLAT_HASH_MAP_HEADER
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace fsc {
+namespace detail {
+    /// 64 bit string hash, eight bytes per step
+    inline std::uint64_t hash_key(std::string_view key) noexcept {
+        std::uint64_t const mul = 0x9e3779b97f4a7c15ull;
+        std::uint64_t h = key.size() * mul;
+        char const *p = key.data();
+        auto n = key.size();
+        for(; n >= 8; n -= 8, p += 8) {
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            h = (h ^ w) * mul;
+            h ^= h >> 29;
+        }
+        std::uint64_t w = 0;
+        std::memcpy(&w, p, n);
+        h = (h ^ w) * mul;
+        // final avalanche (murmur3 fmix64)
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    /** @brief owns the bytes of the keys
+     *
+     * Keys are appended to large chunks, a std::string_view into the arena
+     * stays valid until clear() or destruction, also if the arena is moved.
+     * The chunks are allocated from `res`, every chunk remembers its
+     * resource, i.e. chunks of an absorbed arena go back to theirs.
+     */
+    class key_arena {
+    public:
+        explicit key_arena(std::pmr::memory_resource *res =
+                               std::pmr::get_default_resource()) noexcept
+            : res_(res), chunks_(res) {}
+        key_arena(key_arena const &) = delete;
+        key_arena(key_arena &&rhs) noexcept
+            : res_(rhs.res_),
+              chunks_(std::move(rhs.chunks_)),
+              total_(rhs.total_),
+              cap_(rhs.cap_),
+              used_(rhs.used_) {
+            rhs.reset_();
+        }
+        key_arena &operator=(key_arena const &) = delete;
+        key_arena &operator=(key_arena &&rhs) noexcept {
+            if(this != &rhs) {
+                release_();
+                chunks_ = std::move(rhs.chunks_);
+                total_ = rhs.total_;
+                cap_ = rhs.cap_;
+                used_ = rhs.used_;
+                rhs.reset_();
+            }
+            return *this;
+        }
+        ~key_arena() { release_(); }
+
+        std::string_view store(std::string_view key) {
+            if(key.empty()) return std::string_view();
+            if(key.size() > cap_ - used_) {
+                std::size_t const cap = std::max(key.size(), chunk_size_);
+                add_chunk_(cap);
+                total_ += cap;
+                cap_ = cap;
+                used_ = 0;
+            }
+            char *const p = chunks_.back().p + used_;
+            std::memcpy(p, key.data(), key.size());
+            used_ += key.size();
+            return std::string_view(p, key.size());
+        }
+        /// takes over the keys of `rhs`, they stay valid, `rhs` is empty
+        void absorb(key_arena &&rhs) {
+            // our last chunk stays last, it is the one that is filled
+            chunks_.insert(chunks_.begin(), rhs.chunks_.begin(),
+                           rhs.chunks_.end());
+            total_ += rhs.total_;
+            rhs.reset_();
+        }
+        /// forgets all keys, the memory is kept as one chunk for reuse
+        void clear() {
+            if(chunks_.size() > 1) {
+                auto const total = total_;
+                release_();
+                total_ = 0;
+                add_chunk_(total);
+                total_ = total;
+            }
+            cap_ = total_;
+            used_ = 0;
+        }
+
+    private:
+        struct chunk {
+            char *p;
+            std::size_t size;
+            std::pmr::memory_resource *res;
+        };
+        void add_chunk_(std::size_t const &size) {
+            chunks_.reserve(chunks_.size() + 1);  // no leak if this throws
+            chunks_.push_back(
+                chunk{static_cast<char *>(res_->allocate(size, 1)), size, res_});
+        }
+        void release_() noexcept {
+            for(auto const &c : chunks_) c.res->deallocate(c.p, c.size, 1);
+            chunks_.clear();
+        }
+        // forgets the chunks without releasing them
+        void reset_() noexcept {
+            chunks_.clear();
+            total_ = cap_ = used_ = 0;
+        }
+
+        static constexpr std::size_t chunk_size_ = 4096;
+        std::pmr::memory_resource *res_;
+        std::pmr::vector<chunk> chunks_;
+        std::size_t total_ = 0;
+        std::size_t cap_ = 0;
+        std::size_t used_ = 0;
+    };
+
+    /* a key_arena that is copied as an empty arena. Holds the raw tokens of
+     * lazy_poly_type values, which are classified when they are copied,
+     * i.e. a copy never refers to the arena of the original.
+     */
+    class token_arena : public key_arena {
+    public:
+        using key_arena::key_arena;
+        token_arena() = default;
+        token_arena(token_arena const &) noexcept : key_arena() {}
+        token_arena(token_arena &&) = default;
+        token_arena &operator=(token_arena const &) noexcept { return *this; }
+        token_arena &operator=(token_arena &&) = default;
+    };
+
+    /** @brief open addressing index from a key to a position
+     *
+     * The entries themselves live in a dense array of the owner, the index
+     * only stores their position and 32 bits of their hash. Linear probing,
+     * power of two capacity, at most 50% load. There is no erase.
+     */
+    class flat_index {
+    public:
+        static constexpr std::uint32_t npos = std::uint32_t(-1);
+
+        flat_index() = default;
+        explicit flat_index(std::pmr::memory_resource *res) : slots_(res) {}
+
+        /// `key_at(pos)` returns the key stored at position `pos`
+        template <typename KeyAt>
+        std::uint32_t find(std::string_view key, std::uint64_t const &hash,
+                           KeyAt const &key_at) const noexcept {
+            if(slots_.empty()) return npos;
+            auto const h = std::uint32_t(hash);
+            auto const mask = slots_.size() - 1;
+            for(auto i = h & mask;; i = (i + 1) & mask) {
+                auto const &s = slots_[i];
+                if(s.pos == npos) return npos;
+                if(s.hash == h and key_at(s.pos) == key) return s.pos;
+            }
+        }
+        /// the key at `pos` must not be present yet, `size` is the number of
+        /// entries after the insertion
+        void insert(std::uint64_t const &hash, std::uint32_t const &pos,
+                    std::size_t const &size) {
+            if(2 * size > slots_.size()) grow_(2 * size);
+            place_(slot{std::uint32_t(hash), pos});
+        }
+        /// forgets all positions, but keeps the buckets
+        void clear() noexcept {
+            for(auto &s : slots_) s.pos = npos;
+        }
+        void reserve(std::size_t const &size) {
+            if(2 * size > slots_.size()) grow_(2 * size);
+        }
+
+    private:
+        struct slot {
+            std::uint32_t hash = 0;
+            std::uint32_t pos = npos;
+        };
+        void place_(slot const &s) noexcept {
+            auto const mask = slots_.size() - 1;
+            auto i = s.hash & mask;
+            while(slots_[i].pos != npos) i = (i + 1) & mask;
+            slots_[i] = s;
+        }
+        void grow_(std::size_t const &min) {
+            std::size_t cap = 16;
+            while(cap < min) cap *= 2;
+            std::pmr::vector<slot> old(cap, slot(), slots_.get_allocator());
+            old.swap(slots_);
+            for(auto const &s : old)
+                if(s.pos != npos) place_(s);
+        }
+        std::pmr::vector<slot> slots_;
+    };
+
+    /** @brief insertion ordered hash map from std::string_view to V
+     *
+     * The map does not own the bytes of its keys, see hashed_keys.
+     * Iteration yields `std::pair<std::string_view, V>` in insertion order.
+     */
+    template <typename V>
+    class flat_hash_map {
+        using entry_type = std::pair<std::string_view, V>;
+        using vec_type = std::pmr::vector<entry_type>;
+
+    public:
+        using key_type = std::string_view;
+        using mapped_type = V;
+        using value_type = entry_type;
+        using size_type = typename vec_type::size_type;
+        using iterator = typename vec_type::iterator;
+        using const_iterator = typename vec_type::const_iterator;
+
+        flat_hash_map() = default;
+        explicit flat_hash_map(std::pmr::memory_resource *res)
+            : entries_(res), index_(res) {}
+
+        //------------------- const fct -------------------
+        const_iterator begin() const noexcept { return entries_.begin(); }
+        const_iterator end() const noexcept { return entries_.end(); }
+        size_type size() const noexcept { return entries_.size(); }
+        bool empty() const noexcept { return entries_.empty(); }
+        size_type count(std::string_view key) const noexcept {
+            return find_(key) != flat_index::npos;
+        }
+        const_iterator find(std::string_view key) const noexcept {
+            auto const pos = find_(key);
+            return pos == flat_index::npos ? end() : begin() + pos;
+        }
+        V const &at(std::string_view key) const {
+            auto const pos = find_(key);
+            if(pos == flat_index::npos)
+                throw std::out_of_range("map::at: key \"" + std::string(key) +
+                                        "\" not found!");
+            return entries_[pos].second;
+        }
+        //------------------- modifier -------------------
+        iterator begin() noexcept { return entries_.begin(); }
+        iterator end() noexcept { return entries_.end(); }
+        iterator find(std::string_view key) noexcept {
+            auto const pos = find_(key);
+            return pos == flat_index::npos ? end() : begin() + pos;
+        }
+        /// `key` must not be present and has to outlive the map
+        V &insert(std::string_view key, V val) {
+            entries_.emplace_back(key, std::move(val));
+            index_.insert(hash_key(key), entries_.size() - 1, entries_.size());
+            return entries_.back().second;
+        }
+        /// returns the value of `key` (false) or inserts `make()`, a
+        /// value_type whose key equals `key` and outlives the map (true).
+        /// `key` is hashed once.
+        template <typename Make>
+        std::pair<V *, bool> find_or_insert(std::string_view key,
+                                            Make const &make) {
+            auto const hash = hash_key(key);
+            auto const pos = find_(key, hash);
+            if(pos != flat_index::npos) return {&entries_[pos].second, false};
+            entries_.push_back(make());
+            index_.insert(hash, entries_.size() - 1, entries_.size());
+            return {&entries_.back().second, true};
+        }
+        void reserve(size_type const &size) {
+            entries_.reserve(size);
+            index_.reserve(size);
+        }
+        void clear() noexcept {
+            entries_.clear();
+            index_.clear();
+        }
+
+    private:
+        std::uint32_t find_(std::string_view key) const noexcept {
+            return find_(key, hash_key(key));
+        }
+        std::uint32_t find_(std::string_view key,
+                            std::uint64_t const &hash) const noexcept {
+            return index_.find(key, hash, [this](std::uint32_t p) {
+                return entries_[p].first;
+            });
+        }
+        vec_type entries_;
+        flat_index index_;
+    };
+
+    /** @brief insertion ordered hash set of std::string_view
+     *
+     * The set does not own the bytes of its keys, see hashed_keys.
+     */
+    class flat_hash_set {
+        using vec_type = std::pmr::vector<std::string_view>;
+
+    public:
+        using key_type = std::string_view;
+        using value_type = std::string_view;
+        using size_type = vec_type::size_type;
+        using const_iterator = vec_type::const_iterator;
+
+        flat_hash_set() = default;
+        explicit flat_hash_set(std::pmr::memory_resource *res)
+            : keys_(res), index_(res) {}
+
+        const_iterator begin() const noexcept { return keys_.begin(); }
+        const_iterator end() const noexcept { return keys_.end(); }
+        size_type size() const noexcept { return keys_.size(); }
+        bool empty() const noexcept { return keys_.empty(); }
+        size_type count(std::string_view key) const noexcept {
+            return index_.find(key, hash_key(key), [this](std::uint32_t p) {
+                return keys_[p];
+            }) != flat_index::npos;
+        }
+        /// `key` must not be present and has to outlive the set
+        void insert(std::string_view key) {
+            keys_.push_back(key);
+            index_.insert(hash_key(key), keys_.size() - 1, keys_.size());
+        }
+        void reserve(size_type const &size) {
+            keys_.reserve(size);
+            index_.reserve(size);
+        }
+        void clear() noexcept {
+            keys_.clear();
+            index_.clear();
+        }
+
+    private:
+        vec_type keys_;
+        flat_index index_;
+    };
+}  // end namespace detail
+}  // end namespace fsc
+/// \endcond
+
+#endif  // FSC_FLAT_HASH_MAP_HEADER
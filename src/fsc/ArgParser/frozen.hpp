@@ -0,0 +1,370 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    frozen.hpp
+
+#ifndef FSC_FROZEN_HEADER
+#define FSC_FROZEN_HEADER
+
+#include "flat_hash_map.hpp"
+#include "poly_type.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace fsc {
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    // an unboxed value of a FrozenArgParser, strings live in its pool
+    struct frozen_rep {
+        enum class tag : unsigned char {
+            empty,
+            boolean,
+            integer,
+            floating,
+            string,
+            flag  // a key without value
+        };
+        struct span {
+            std::uint32_t off;
+            std::uint32_t len;
+        };
+        tag tag_ = tag::empty;
+        union {
+            bool b;
+            int i;
+            double d;
+            span s;
+        };
+        frozen_rep() noexcept : i(0) {}
+    };
+}  // end namespace detail
+/// @endcond
+
+/** @brief a read-only value of a FrozenArgParser
+ *
+ * Casts like a fsc::poly_type, i.e. an int converts to a double but not to a
+ * std::string. A string value also converts to a std::string_view into the
+ * pool of the FrozenArgParser, which does not copy it.
+ */
+class frozen_value {
+    template <typename T>
+    using enable_if_cast_t =
+        std::enable_if_t<std::is_arithmetic<T>::value or
+                         std::is_same<T, std::string>::value or
+                         std::is_same<T, std::string_view>::value>;
+    using tag = detail::frozen_rep::tag;
+
+public:
+    //------------------- cast -------------------
+    template <typename T, typename = enable_if_cast_t<T>>
+    operator T() const {
+        switch(rep_->tag_) {
+            case(tag::integer):
+                return detail::convert<T>::from(rep_->i);
+            case(tag::floating):
+                return detail::convert<T>::from(rep_->d);
+            case(tag::boolean):
+                return detail::convert<T>::from(rep_->b);
+            case(tag::string):
+                if constexpr(std::is_same<T, std::string_view>::value)
+                    return view_();
+                else if constexpr(std::is_same<T, std::string>::value)
+                    return std::string(view_());
+                else
+                    return detail::convert<T>::from(std::string());
+            default:
+                return T();
+        }
+    }
+    //------------------- const fct -------------------
+    std::type_info const &type() const noexcept {
+        switch(rep_->tag_) {
+            case(tag::boolean):
+                return typeid(bool);
+            case(tag::integer):
+                return typeid(int);
+            case(tag::floating):
+                return typeid(double);
+            case(tag::string):
+                return typeid(std::string);
+            default:
+                return typeid(void);
+        }
+    }
+    template <typename S>
+    void print(S &os) const {
+        switch(rep_->tag_) {
+            case(tag::boolean):
+                os << rep_->b;
+                break;
+            case(tag::integer):
+                os << rep_->i;
+                break;
+            case(tag::floating):
+                os << rep_->d;
+                break;
+            case(tag::string):
+                os << view_();
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    friend class FrozenArgParser;
+    frozen_value(detail::frozen_rep const &rep, char const *pool) noexcept
+        : rep_(&rep), pool_(pool) {}
+    std::string_view view_() const noexcept {
+        return std::string_view(pool_ + rep_->s.off, rep_->s.len);
+    }
+
+    detail::frozen_rep const *rep_;
+    char const *pool_;
+};
+
+inline std::ostream &operator<<(std::ostream &os, frozen_value const &val) {
+    val.print(os);
+    return os;
+}
+
+/** @brief an immutable snapshot of an ArgParser
+ *
+ * Created with \link fsc::ArgParserTpl::freeze freeze() \endlink once the
+ * arguments are final. All keys and string values are copied into one
+ * contiguous pool, numbers and booleans are stored unboxed and the keys are
+ * found with a hash index that is built once. There is no modifier and no
+ * const member writes to the snapshot, i.e. it can be read from any number
+ * of threads at the same time without a lock.
+ *
+ * The accessors are the same as the ones of fsc::ArgParser, the values are
+ * returned as fsc::frozen_value.
+ */
+class FrozenArgParser {
+    using rep_type = detail::frozen_rep;
+    using tag = rep_type::tag;
+
+public:
+    using value_type = frozen_value;  ///< the returned value of the arguments
+    using size_type = std::size_t;
+
+    //------------------- structors -------------------
+    /**@brief an empty snapshot
+     */
+    FrozenArgParser() = default;
+    /**@brief copy the arguments into a snapshot
+     *
+     * `named` is iterated as (key, value) pairs, `flags` as keys and
+     * `free` as values. A value is a fsc::poly_type (or derived) or a
+     * std::string. This is what ArgParserTpl::freeze() calls.
+     */
+    template <typename N, typename F, typename A>
+    FrozenArgParser(N const &named, F const &flags, A const &free,
+                    std::string cwd, std::string pwd, std::string progname)
+        : cwd_(std::move(cwd)),
+          pwd_(std::move(pwd)),
+          progname_(std::move(progname)) {
+        keys_.reserve(named.size() + flags.size());
+        for(auto const &it : named)
+            keys_.push_back(entry{store_(it.first), rep_of_(it.second)});
+        for(auto const &it : flags) {
+            entry e{store_(it), rep_type()};
+            e.val.tag_ = tag::flag;
+            keys_.push_back(e);
+        }
+        for(auto const &it : free) f_args_.push_back(rep_of_(it));
+        index_.reserve(keys_.size());
+        for(std::size_t i = 0; i < keys_.size(); ++i)
+            index_.insert(detail::hash_key(key_(keys_[i])),
+                          std::uint32_t(i), i + 1);
+    }
+
+    //------------------- const getter -------------------
+    /**@brief get named argument if set
+     * @param key is the name of the desired named argument
+     *
+     * If `key` is not found, a std::runtime_error is thrown.
+     */
+    value_type operator[](std::string_view key) const {
+        auto const *e = find_(key);
+        if(!e or e->val.tag_ == tag::flag)
+            throw std::runtime_error("ArgParser error: named argument '" +
+                                     std::string(key) + "' not found");
+        return value_type(e->val, pool_.data());
+    }
+    /**@brief get free argument if set
+     * @param pos position of the free argument
+     *
+     * If `pos >= freeargc()` a std::runtime_error is thrown.
+     */
+    value_type operator[](size_type const &pos) const {
+        if(pos >= freeargc())
+            throw std::runtime_error("ArgParser error: free argument '" +
+                                     std::to_string(pos) + "' not found");
+        return value_type(f_args_[pos], pool_.data());
+    }
+    /**@brief get named argument if set, else a default
+     * @param key name of the named argument
+     * @param def is a default that is returned if `key` is not found
+     *
+     * If `key` is found but not convertibly to `decltype(def)`,
+     * a std::runtime_error is thrown.
+     */
+    template <typename T>
+    T get(std::string_view key, T const &def) const {
+        auto const *e = find_(key);
+        if(e and e->val.tag_ != tag::flag)
+            return value_type(e->val, pool_.data());
+        else
+            return def;
+    }
+    /**@brief special treatment of `char const *`
+     */
+    std::string get(std::string_view key, char const *def) const {
+        return get<std::string>(key, def);
+    }
+    /**@brief get free argument if set, else a default
+     */
+    template <typename T>
+    T get(size_type const &pos, T const &def) const {
+        if(is_set(pos))
+            return value_type(f_args_[pos], pool_.data());
+        else
+            return def;
+    }
+    /**@brief special treatment of `char const *`
+     */
+    std::string get(size_type const &pos, char const *def) const {
+        return get<std::string>(pos, def);
+    }
+    /**@brief check if flag or named argument is set
+     */
+    bool is_set(std::string_view key) const noexcept {
+        return find_(key) != nullptr;
+    }
+    /**@brief check if free argument is set
+     */
+    bool is_set(size_type const &pos) const noexcept {
+        return pos < freeargc();
+    }
+    /**@brief returns the number of free arguments
+     */
+    size_type freeargc() const noexcept { return f_args_.size(); }
+    /**@brief returns the current working directory
+     *
+     * If not set (fsc::no_paths), a std::runtime_error is thrown.
+     */
+    std::string const &cwd() const {
+        if(cwd_ == "") throw std::runtime_error("ArgParser error: cwd not set");
+        return cwd_;
+    }
+    /**@brief returns the program working directory
+     *
+     * If not set, a std::runtime_error is thrown.
+     */
+    std::string const &pwd() const {
+        if(pwd_ == "") throw std::runtime_error("ArgParser error: pwd not set");
+        return pwd_;
+    }
+    /**@brief returns the program name
+     *
+     * If not set, a std::runtime_error is thrown.
+     */
+    std::string const &progname() const {
+        if(progname_ == "")
+            throw std::runtime_error("ArgParser error: progname not set");
+        return progname_;
+    }
+
+    /**@brief prints the snapshot in the same form as an ArgParser
+     */
+    template <typename S>
+    void print(S &os) const noexcept {
+        os << "=======ArgParser=======\n";
+        os << "free_args:\n";
+        for(auto const &it : f_args_)
+            os << "    " << value_type(it, pool_.data()) << '\n';
+        os << "named_args:\n";
+        for(auto const &it : keys_)
+            if(it.val.tag_ != tag::flag)
+                os << "    " << key_(it) << " \t"
+                   << value_type(it.val, pool_.data()) << '\n';
+        os << "flags:\n";
+        for(auto const &it : keys_)
+            if(it.val.tag_ == tag::flag) os << "    " << key_(it) << '\n';
+        os << "special member:\n";
+        os << "    cwd \t" << cwd_ << '\n';
+        os << "    pwd \t" << pwd_ << '\n';
+        os << "    progname \t" << progname_;
+    }
+
+private:
+    struct entry {
+        rep_type::span key;
+        rep_type val;
+    };
+
+    std::string_view key_(entry const &e) const noexcept {
+        return std::string_view(pool_.data() + e.key.off, e.key.len);
+    }
+    entry const *find_(std::string_view key) const noexcept {
+        auto const pos =
+            index_.find(key, detail::hash_key(key),
+                        [this](std::uint32_t p) { return key_(keys_[p]); });
+        return pos == detail::flat_index::npos ? nullptr : &keys_[pos];
+    }
+    rep_type::span store_(std::string_view str) {
+        if(pool_.size() + str.size() > std::uint32_t(-1))
+            throw std::length_error("ArgParser error: frozen pool too large");
+        rep_type::span const res{std::uint32_t(pool_.size()),
+                                 std::uint32_t(str.size())};
+        pool_.append(str);
+        return res;
+    }
+    rep_type rep_of_(std::string const &val) {
+        rep_type res;
+        res.s = store_(val);
+        res.tag_ = tag::string;
+        return res;
+    }
+    rep_type rep_of_(poly_type const &val) {
+        rep_type res;
+        auto const &type = val.type();  // classifies a lazy_poly_type
+        if(type == typeid(bool)) {
+            res.b = val;
+            res.tag_ = tag::boolean;
+        } else if(type == typeid(int)) {
+            res.i = val;
+            res.tag_ = tag::integer;
+        } else if(type == typeid(double)) {
+            res.d = val;
+            res.tag_ = tag::floating;
+        } else if(type == typeid(std::string))
+            return rep_of_(std::string(val));
+        return res;
+    }
+
+    std::string pool_;          // all keys and string values
+    std::vector<entry> keys_;   // named arguments and flags, in order
+    detail::flat_index index_;  // key -> position in keys_
+    std::vector<rep_type> f_args_;
+    std::string cwd_;
+    std::string pwd_;
+    std::string progname_;
+};
+
+/**@brief stream operator for the snapshot
+ */
+inline std::ostream &operator<<(std::ostream &os, FrozenArgParser const &arg) {
+    arg.print(os);
+    return os;
+}
+
+}  // end namespace fsc
+#endif  // FSC_FROZEN_HEADER
@@ -0,0 +1,208 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    key_handle.hpp
+
+#ifndef FSC_KEY_HANDLE_HEADER
+#define FSC_KEY_HANDLE_HEADER
+
+#include "flat_hash_map.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fsc {
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    template <typename V>
+    class key_interner;
+}  // end namespace detail
+/// @endcond
+
+/** @brief an interned key of an ArgParser, see ArgParserTpl::handle
+ *
+ * A handle is an index into the intern table of the parser that returned
+ * it. It stays valid until that parser is destroyed or assigned to and can
+ * be used with its copies, since they copy the table. Keys that are
+ * interned after a copy only belong to the parser they were interned in,
+ * using their handle with the other one throws. A parser that is assigned
+ * to takes over the table of the right hand side, i.e. it accepts the
+ * handles of that side and throws for the ones it returned before.
+ */
+class key_handle {
+public:
+    /// the position of the key in the intern table
+    std::uint32_t id() const noexcept { return id_; }
+    bool operator==(key_handle const &rhs) const noexcept {
+        return id_ == rhs.id_ and table_ == rhs.table_;
+    }
+    bool operator!=(key_handle const &rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+private:
+    template <typename V>
+    friend class detail::key_interner;
+    key_handle(std::uint64_t const &table, std::uint32_t const &id) noexcept
+        : table_(table), id_(id) {}
+    std::uint64_t table_;  // the table the key was interned in
+    std::uint32_t id_;
+};
+
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    /* the intern table of an ArgParserTpl. Keys are only ever added, i.e.
+     * a handle stays valid whatever happens to the arguments. Every key
+     * caches where its value is (or that it is a flag or not set), tagged
+     * with the generation it was looked up in. The parser starts a new
+     * generation whenever keys are inserted or removed, which is the only
+     * time the cached pointers can dangle. A copy or move starts a new
+     * generation as well, its cache would point into the other parser.
+     *
+     * Interning is not const. A cached lookup is refreshed by const reads,
+     * which may run in several threads at the same time: they all store
+     * the same result and publish it with the generation.
+     *
+     * Every table has a unique tag. A copy gets a new tag and remembers the
+     * tags of the tables it was copied from with the number of keys they
+     * had at that time, these are the handles it shares with them. An
+     * assignment replaces the table, tag and origins with the ones of rhs,
+     * the handles of the old table are rejected from then on.
+     */
+    template <typename V>
+    class key_interner {
+    public:
+        struct entry {
+            entry(std::string_view n) noexcept : name(n) {}
+            entry(entry const &rhs) noexcept : name(rhs.name) {}
+            std::string_view name;
+            // the cache, refreshed by const lookups
+            mutable std::atomic<V const *> val{nullptr};  // a named argument
+            mutable std::atomic<bool> flag{false};        // set as flag
+            mutable std::atomic<std::uint64_t> gen{0};  // current if == gen_
+        };
+        struct cached {
+            V const *val;
+            bool flag;
+        };
+
+        key_interner() = default;
+        key_interner(key_interner const &rhs) : origins_(rhs.origins_) {
+            origins_.push_back(
+                origin{rhs.tag_, std::uint32_t(rhs.entries_.size())});
+            copy_(rhs);
+        }
+        key_interner(key_interner &&rhs) noexcept
+            : keys_(std::move(rhs.keys_)),
+              ids_(std::move(rhs.ids_)),
+              entries_(std::move(rhs.entries_)),
+              origins_(std::move(rhs.origins_)),
+              tag_(rhs.tag_),
+              gen_(rhs.gen_ + 1) {
+            rhs.clear_();
+        }
+        key_interner &operator=(key_interner const &rhs) {
+            if(this != &rhs) {
+                key_interner tmp(rhs);
+                *this = std::move(tmp);
+            }
+            return *this;
+        }
+        key_interner &operator=(key_interner &&rhs) noexcept {
+            if(this != &rhs) {
+                keys_ = std::move(rhs.keys_);
+                ids_ = std::move(rhs.ids_);
+                entries_ = std::move(rhs.entries_);
+                origins_ = std::move(rhs.origins_);
+                tag_ = rhs.tag_;
+                gen_ = std::max(gen_, rhs.gen_) + 1;
+                rhs.clear_();
+            }
+            return *this;
+        }
+
+        key_handle intern(std::string_view key) {
+            auto const it = ids_.find(key);
+            if(it != ids_.end()) return key_handle(tag_, it->second);
+            auto const id = std::uint32_t(entries_.size());
+            auto const name = keys_.store(key);
+            entries_.emplace_back(name);
+            ids_.insert(name, id);
+            return key_handle(tag_, id);
+        }
+        std::string_view name(key_handle const &h) const {
+            return at_(h).name;
+        }
+        // the cached lookup of `h`, refreshed with `find(name, val, flag)`
+        // if stale
+        template <typename Find>
+        cached lookup(key_handle const &h, Find &&find) const {
+            auto &e = at_(h);
+            if(e.gen.load(std::memory_order_acquire) == gen_)
+                return {e.val.load(std::memory_order_relaxed),
+                        e.flag.load(std::memory_order_relaxed)};
+            cached res{nullptr, false};
+            find(e.name, res.val, res.flag);
+            e.val.store(res.val, std::memory_order_relaxed);
+            e.flag.store(res.flag, std::memory_order_relaxed);
+            e.gen.store(gen_, std::memory_order_release);
+            return res;
+        }
+        // keys were inserted or removed, all cached lookups are stale
+        void touch() noexcept { ++gen_; }
+
+    private:
+        struct origin {
+            std::uint64_t tag;
+            std::uint32_t size;  // the number of shared handles
+        };
+        static std::uint64_t new_tag_() noexcept {
+            static std::atomic<std::uint64_t> next{1};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        entry const &at_(key_handle const &h) const {
+            check_(h);
+            return entries_[h.id()];
+        }
+        void check_(key_handle const &h) const {
+            bool ok = h.table_ == tag_;
+            for(auto const &o : origins_)
+                if(o.tag == h.table_) ok = h.id() < o.size;
+            if(!ok or h.id() >= entries_.size())
+                throw std::runtime_error(
+                    "ArgParser error: key handle of another parser");
+        }
+        void copy_(key_interner const &rhs) {
+            entries_.reserve(rhs.entries_.size());
+            ids_.reserve(rhs.entries_.size());
+            for(auto const &e : rhs.entries_) {
+                auto const name = keys_.store(e.name);
+                ids_.insert(name, std::uint32_t(entries_.size()));
+                entries_.emplace_back(name);
+            }
+        }
+        // a moved-from table is empty and shares nothing
+        void clear_() noexcept {
+            ids_.clear();
+            entries_.clear();
+            origins_.clear();
+            tag_ = new_tag_();
+        }
+
+        key_arena keys_;
+        flat_hash_map<std::uint32_t> ids_;
+        std::vector<entry> entries_;
+        std::vector<origin> origins_;  // the tables this one was copied from
+        std::uint64_t tag_ = new_tag_();
+        std::uint64_t gen_ = 1;
+    };
+}  // end namespace detail
+/// @endcond
+}  // end namespace fsc
+
+#endif  // FSC_KEY_HANDLE_HEADER
@@ -0,0 +1,344 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    key_storage.hpp
+
+#ifndef FSC_KEY_STORAGE_HEADER
+#define FSC_KEY_STORAGE_HEADER
+
+#include "flat_hash_map.hpp"
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fsc {
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    template <typename map_type>
+    struct verbose_map : public map_type {
+        using typename map_type::key_type;
+        using typename map_type::mapped_type;
+        using map_type::map_type;
+
+        mapped_type const &at(key_type const &key) const {
+            try {
+                return map_type::at(key);
+            } catch(std::out_of_range const &) {
+                throw std::out_of_range("map::at: key \"" + std::string(key) +
+                                        "\" not found!");
+            }
+        }
+    };
+
+    /* A store holds the named arguments and the flags of an ArgParserTpl.
+     * Keys are never removed. Interface:
+     *
+     * explicit store(std::pmr::memory_resource *);   allocate from it, or
+     *                                               ignore it
+     * named_type const & named() const;   iterable as (key, value) pairs
+     * flag_type const & flags() const;    iterable as keys
+     * V * find_named(std::string_view);   nullptr if not present
+     * bool has_flag(std::string_view) const;
+     * V & insert_named(std::string_view, V);   key must not be present
+     * std::pair<V *, bool> find_or_insert_named(std::string_view, Make);
+     *     one lookup, inserts make() if the key is not present (true)
+     * void insert_flag(std::string_view);      key must not be present
+     * void clear();
+     * void merge(store const & / store &&, bool overwrite, Diag const &);
+     *
+     * merge() has the same effect as inserting the named arguments of rhs
+     * one at a time in the order of rhs.named(), then its flags in the order
+     * of rhs.flags(). `Diag` is told about what happens on the way:
+     *
+     * diag.overwrite(key, old, val);   before `old` is overwritten by `val`
+     * diag.flag_twice(key);            a flag of rhs is already set
+     *
+     * The caller makes sure that no flag of one store is a named argument
+     * of the other, i.e. merge() only throws if it runs out of memory.
+     * A store that is merged as rvalue is left empty.
+     */
+
+    /* named arguments in a sorted std::map, flags in insertion order with
+     * a sorted index. The flags live in a std::deque, i.e. they never move
+     * and the index can refer to them. Nodes, keys and flags are allocated
+     * from the resource of the store, the values allocate on their own.
+     */
+    template <typename V>
+    class ordered_store {
+    public:
+        using named_type = verbose_map<
+            std::pmr::map<std::pmr::string, V, std::less<>>>;
+        using flag_type = std::pmr::deque<std::pmr::string>;
+
+        ordered_store() = default;
+        /// nodes, keys, flags and the index are allocated from `res`
+        explicit ordered_store(std::pmr::memory_resource *res)
+            : named_(res), flags_(res), flag_index_(res) {}
+        ordered_store(ordered_store const &rhs)
+            : named_(rhs.named_), flags_(rhs.flags_) {
+            index_flags_();
+        }
+        ordered_store(ordered_store &&) = default;
+        ordered_store &operator=(ordered_store const &rhs) {
+            if(this != &rhs) {
+                named_ = rhs.named_;
+                flags_ = rhs.flags_;
+                index_flags_();
+            }
+            return *this;
+        }
+        ordered_store &operator=(ordered_store &&rhs) {
+            if(this != &rhs) {
+                // with another resource the flags are moved one by one,
+                // i.e. the index of rhs would refer to its old flags
+                bool const same = flags_.get_allocator() ==
+                                  rhs.flags_.get_allocator();
+                named_ = std::move(rhs.named_);
+                flags_ = std::move(rhs.flags_);
+                if(same)
+                    flag_index_ = std::move(rhs.flag_index_);
+                else
+                    index_flags_();
+                rhs.clear();
+            }
+            return *this;
+        }
+
+        named_type const &named() const noexcept { return named_; }
+        flag_type const &flags() const noexcept { return flags_; }
+
+        V *find_named(std::string_view key) noexcept {
+            auto it = named_.find(key);
+            return it == named_.end() ? nullptr : &it->second;
+        }
+        V const *find_named(std::string_view key) const noexcept {
+            auto it = named_.find(key);
+            return it == named_.end() ? nullptr : &it->second;
+        }
+        bool has_flag(std::string_view key) const noexcept {
+            return flag_index_.count(key);
+        }
+        V &insert_named(std::string_view key, V val) {
+            return named_.emplace(key, std::move(val)).first->second;
+        }
+        template <typename Make>
+        std::pair<V *, bool> find_or_insert_named(std::string_view key,
+                                                  Make const &make) {
+            auto it = named_.lower_bound(key);
+            if(it != named_.end() and it->first == key)
+                return {&it->second, false};
+            return {&named_.emplace_hint(it, key, make())->second, true};
+        }
+        void insert_flag(std::string_view key) {
+            flag_index_.insert(flags_.emplace_back(key));
+        }
+        void clear() noexcept {
+            named_.clear();
+            flag_index_.clear();
+            flags_.clear();
+        }
+        template <typename Store, typename Diag>
+        std::enable_if_t<std::is_same<std::decay_t<Store>, ordered_store>::value>
+        merge(Store &&rhs, bool const &overwrite, Diag const &diag) {
+            constexpr bool move = !std::is_lvalue_reference<Store>::value;
+            // nodes can only be spliced between maps of the same resource
+            bool const splice =
+                move and named_.get_allocator() == rhs.named_.get_allocator();
+            // both key sequences are sorted: walk along this map, unless rhs
+            // is so small that looking up every key is cheaper. Either way
+            // the new keys are inserted at the right place with a hint.
+            bool const walk = 32 * rhs.named_.size() >= named_.size();
+            auto hint = named_.begin();
+            for(auto it = rhs.named_.begin(); it != rhs.named_.end();) {
+                auto const cur = it++;
+                std::string_view const key = cur->first;
+                if(walk)
+                    while(hint != named_.end() and hint->first < key) ++hint;
+                else
+                    hint = named_.lower_bound(key);
+
+                if(hint != named_.end() and hint->first == key) {
+                    if(overwrite) {
+                        diag.overwrite(key, hint->second, cur->second);
+                        if constexpr(move)
+                            hint->second = std::move(cur->second);
+                        else
+                            hint->second = cur->second;
+                    }
+                    continue;
+                }
+                if constexpr(move) {
+                    if(splice)
+                        hint = named_.insert(hint, rhs.named_.extract(cur));
+                    else
+                        hint = named_.emplace_hint(hint, cur->first,
+                                                   std::move(cur->second));
+                } else
+                    hint = named_.emplace_hint(hint, cur->first, cur->second);
+                ++hint;
+            }
+            for(auto &flag : rhs.flags_) {
+                if(has_flag(flag))
+                    diag.flag_twice(flag);
+                else {
+                    if constexpr(move)
+                        flag_index_.insert(flags_.emplace_back(std::move(flag)));
+                    else
+                        insert_flag(flag);
+                }
+            }
+            if constexpr(move) rhs.clear();
+        }
+
+    private:
+        void index_flags_() {
+            flag_index_.clear();
+            for(auto const &flag : flags_) flag_index_.insert(flag);
+        }
+        named_type named_;
+        flag_type flags_;
+        std::pmr::set<std::string_view> flag_index_;  // views into flags_
+    };
+
+    /// named arguments and flags in flat hash tables, keys in one arena
+    template <typename V>
+    class hashed_store {
+    public:
+        using named_type = flat_hash_map<V>;
+        using flag_type = flat_hash_set;
+
+        hashed_store() = default;
+        /// keys, entries and the index are allocated from `res`
+        explicit hashed_store(std::pmr::memory_resource *res)
+            : keys_(res), named_(res), flags_(res) {}
+        hashed_store(hashed_store const &rhs) { copy_(rhs); }
+        hashed_store(hashed_store &&) = default;
+        hashed_store &operator=(hashed_store const &rhs) {
+            if(this != &rhs) {
+                clear();
+                copy_(rhs);
+            }
+            return *this;
+        }
+        hashed_store &operator=(hashed_store &&) = default;
+
+        named_type const &named() const noexcept { return named_; }
+        flag_type const &flags() const noexcept { return flags_; }
+
+        V *find_named(std::string_view key) noexcept {
+            auto it = named_.find(key);
+            return it == named_.end() ? nullptr : &it->second;
+        }
+        V const *find_named(std::string_view key) const noexcept {
+            auto it = named_.find(key);
+            return it == named_.end() ? nullptr : &it->second;
+        }
+        bool has_flag(std::string_view key) const noexcept {
+            return flags_.count(key);
+        }
+        V &insert_named(std::string_view key, V val) {
+            return named_.insert(keys_.store(key), std::move(val));
+        }
+        template <typename Make>
+        std::pair<V *, bool> find_or_insert_named(std::string_view key,
+                                                  Make const &make) {
+            return named_.find_or_insert(key, [&]() {
+                V val = make();  // may throw, the key is not stored then
+                return typename named_type::value_type(keys_.store(key),
+                                                       std::move(val));
+            });
+        }
+        void insert_flag(std::string_view key) {
+            flags_.insert(keys_.store(key));
+        }
+        void clear() {
+            named_.clear();
+            flags_.clear();
+            keys_.clear();
+        }
+        template <typename Store, typename Diag>
+        std::enable_if_t<std::is_same<std::decay_t<Store>, hashed_store>::value>
+        merge(Store &&rhs, bool const &overwrite, Diag const &diag) {
+            constexpr bool move = !std::is_lvalue_reference<Store>::value;
+            // the keys of rhs become ours without copying them
+            if constexpr(move) keys_.absorb(std::move(rhs.keys_));
+            for(auto &it : rhs.named_) {
+                if(auto *old = find_named(it.first)) {
+                    if(overwrite) {
+                        diag.overwrite(it.first, *old, it.second);
+                        if constexpr(move)
+                            *old = std::move(it.second);
+                        else
+                            *old = it.second;
+                    }
+                    continue;
+                }
+                if constexpr(move)
+                    named_.insert(it.first, std::move(it.second));
+                else
+                    insert_named(it.first, it.second);
+            }
+            for(auto const &flag : rhs.flags_) {
+                if(has_flag(flag))
+                    diag.flag_twice(flag);
+                else {
+                    if constexpr(move)
+                        flags_.insert(flag);
+                    else
+                        insert_flag(flag);
+                }
+            }
+            if constexpr(move) rhs.clear();
+        }
+
+    private:
+        void copy_(hashed_store const &rhs) {
+            named_.reserve(rhs.named_.size());
+            flags_.reserve(rhs.flags_.size());
+            for(auto const &it : rhs.named_) insert_named(it.first, it.second);
+            for(auto const &it : rhs.flags_) insert_flag(it);
+        }
+        key_arena keys_;
+        named_type named_;
+        flag_type flags_;
+    };
+}  // end namespace detail
+/// @endcond
+
+/** @brief default key storage policy of fsc::ArgParserTpl
+ *
+ * Named arguments are kept in a std::map (sorted by key), flags in the
+ * order they were set, with a sorted index. The nodes and keys are
+ * allocated from the memory resource of the parser.
+ */
+struct ordered_keys {
+    /// @cond NEVER_DOCUMENT_THIS_ENTITY
+    template <typename V>
+    using store = detail::ordered_store<V>;
+    /// @endcond
+};
+/** @brief hash table key storage policy of fsc::ArgParserTpl
+ *
+ * Named arguments and flags are kept in open addressing flat hash tables
+ * that share one arena for the key bytes. Inserting and looking up a key is
+ * O(1) on average, also for flags. Named arguments and flags are iterated
+ * (and printed) in the order they were set.
+ *
+ * `fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys> ap(argc, argv);`
+ */
+struct hashed_keys {
+    /// @cond NEVER_DOCUMENT_THIS_ENTITY
+    template <typename V>
+    using store = detail::hashed_store<V>;
+    /// @endcond
+};
+}  // end namespace fsc
+
+#endif  // FSC_KEY_STORAGE_HEADER
@@ -0,0 +1,107 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    mapped_file.hpp
+
+#ifndef FSC_MAPPED_FILE_HEADER
+#define FSC_MAPPED_FILE_HEADER
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <string_view>
+
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace fsc {
+namespace detail {
+    /** @brief read-only view of the content of a file
+     *
+     * Regular files of at least map_threshold bytes are mapped into memory,
+     * i.e. their content is not copied. Everything else (small files, pipes,
+     * ...) is read into a buffer instead. Accessing a mapping of a file that
+     * was truncated by another process raises SIGBUS, use read() for files
+     * that may change while they are parsed.
+     */
+    class mapped_file {
+    public:
+        /// smaller files are cheaper to read than to map and unmap
+        static constexpr std::size_t map_threshold = 64 * 1024;
+
+        mapped_file() = default;
+        mapped_file(mapped_file const &) = delete;
+        mapped_file &operator=(mapped_file const &) = delete;
+        ~mapped_file() { close(); }
+
+        /// returns false if the file cannot be opened
+        bool open(std::string const &filename) {
+            close();
+            int const fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd < 0) return false;
+
+            struct stat st;
+            if(::fstat(fd, &st) == 0 and S_ISREG(st.st_mode) and
+               std::size_t(st.st_size) >= map_threshold) {
+                void *const p = ::mmap(nullptr, st.st_size, PROT_READ,
+                                       MAP_PRIVATE, fd, 0);
+                if(p != MAP_FAILED) {
+                    ::madvise(p, st.st_size, MADV_SEQUENTIAL);
+                    map_ = p;
+                    size_ = st.st_size;
+                    ::close(fd);
+                    return true;
+                }
+            }
+            return read_(fd);
+        }
+        /** returns false if the file cannot be read
+         *
+         * Like open(), but the file is always read into the buffer, whose
+         * capacity is kept from the last file. For many small files this
+         * is cheaper than a mapping, which also has to be unmapped on all
+         * cores that ran the process.
+         */
+        bool read(std::string const &filename) {
+            close();
+            int const fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd < 0) return false;
+            return read_(fd);
+        }
+        std::string_view view() const noexcept {
+            if(map_) return std::string_view(static_cast<char *>(map_), size_);
+            return buffer_;
+        }
+        void close() noexcept {
+            if(map_) ::munmap(map_, size_);
+            map_ = nullptr;
+            size_ = 0;
+            buffer_.clear();
+        }
+
+    private:
+        // reads and closes `fd`
+        bool read_(int const &fd) {
+            bool ok = true;
+            char chunk[4096];
+            while(true) {
+                auto const n = ::read(fd, chunk, sizeof(chunk));
+                if(n == 0) break;
+                if(n < 0) {
+                    ok = false;
+                    break;
+                }
+                buffer_.append(chunk, n);
+            }
+            ::close(fd);
+            return ok;
+        }
+
+        void *map_ = nullptr;
+        std::size_t size_ = 0;
+        std::string buffer_;
+    };
+}  // end namespace detail
+}  // end namespace fsc
+/// \endcond
+
+#endif  // FSC_MAPPED_FILE_HEADER
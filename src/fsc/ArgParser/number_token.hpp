@@ -0,0 +1,167 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    number_token.hpp
+
+#ifndef FSC_NUMBER_TOKEN_HEADER
+#define FSC_NUMBER_TOKEN_HEADER
+
+#include "fsc_except.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace fsc {
+namespace detail {
+    /** @brief the result of classifying a single token
+     *
+     * `i` is valid if `kind == integer`, `d` if `kind == floating`.
+     */
+    struct number_token {
+        enum kind_type { integer, floating, string };
+        kind_type kind = string;
+        int i = 0;
+        double d = 0;
+    };
+
+    /** @brief decides if a token is an int, a double or a string
+     * @param tok the complete token
+     *
+     * A token is an int if all of it is an int, otherwise a double if all of
+     * it is a double and a string in any other case:
+     *
+     * * leading white-space and a single leading `+` or `-` are allowed
+     * * an int that does not fit into `int` becomes a double
+     * * doubles are decimal (`1.5`, `.5`, `1.`, `1e-3`), hexadecimal
+     *   (`0x1p3`), `inf`, `infinity` or `nan`
+     * * a double that overflows stays a string
+     *
+     * The token is scanned once to find its shape and then converted with
+     * std::from_chars, i.e. no exceptions are thrown and the locale is not
+     * consulted.
+     */
+    inline number_token classify_number(std::string_view tok) noexcept {
+        number_token res;
+
+        char const *first = tok.data();
+        char const *const last = first + tok.size();
+
+        while(first != last and (*first == ' ' or (*first >= '\t' and
+                                                   *first <= '\r')))
+            ++first;
+        if(first == last) return res;
+
+        // std::from_chars only knows about '-'
+        bool const neg = (*first == '-');
+        char const *const sign = first;
+        if(*first == '+' or neg) ++first;
+        if(first == last or *first == '+' or *first == '-') return res;
+
+        // one pass to find the shape: only digits -> int candidate
+        char const *it = first;
+        while(it != last and *it >= '0' and *it <= '9') ++it;
+
+        if(it == last) {
+            auto const r = std::from_chars(neg ? sign : first, last, res.i);
+            if(r.ec == std::errc()) {
+                res.kind = number_token::integer;
+                return res;
+            }
+            // out of int range, still fine as double
+        }
+
+        std::chars_format fmt = std::chars_format::general;
+        if(last - first > 2 and first[0] == '0' and
+           (first[1] == 'x' or first[1] == 'X')) {
+            fmt = std::chars_format::hex;
+            first += 2;
+            if(*first == '+' or *first == '-') return res;
+        }
+
+        auto const r = std::from_chars(
+            neg and fmt == std::chars_format::general ? sign : first, last,
+            res.d, fmt);
+        if(r.ec == std::errc() and r.ptr == last) {
+            res.kind = number_token::floating;
+            if(neg and fmt == std::chars_format::hex) res.d = -res.d;
+        }
+        return res;
+    }
+
+    /** @brief converts the value `tok` of the key `key` to `T`
+     *
+     * `T` is arithmetic or std::string. A std::string takes the token as it
+     * is, also if it looks like a number. Throws a
+     * fsc::cat_on_your_keyboard_error if an arithmetic `T` gets a token
+     * that is not a number, an integral `T` (other than bool) gets a number
+     * that is not whole, or the number is out of the range of `T`.
+     * Integers are converted to an integral `T` directly, i.e. all values
+     * of a 64 bit `T` are exact. Other forms, e.g. `1e3`, go through double.
+     */
+    template <typename T>
+    T convert_token(std::string_view key, std::string_view tok) {
+        if constexpr(std::is_same<T, std::string>::value)
+            return std::string(tok);
+        else {
+            auto const error = [&](char const *what) {
+                return cat_on_your_keyboard_error(
+                    "ArgParser error: the value '" + std::string(tok) +
+                    "' of '" + std::string(key) + "' " + what);
+            };
+            if constexpr(std::is_integral<T>::value and
+                         !std::is_same<T, bool>::value) {
+                // the same leading white-space and sign as classify_number
+                char const *first = tok.data();
+                char const *const last = first + tok.size();
+                while(first != last and (*first == ' ' or (*first >= '\t' and
+                                                           *first <= '\r')))
+                    ++first;
+                bool const plus = first != last and *first == '+';
+                if(plus) ++first;
+                char const *it = first;
+                if(!plus and it != last and *it == '-') ++it;
+                if(it != last and std::all_of(it, last, [](char const &c) {
+                       return c >= '0' and c <= '9';
+                   })) {
+                    T val;
+                    auto const r = std::from_chars(first, last, val);
+                    if(r.ec == std::errc()) return val;
+                    if(r.ec == std::errc::result_out_of_range)
+                        throw error("is out of range");
+                    // a negative value of an unsigned T, see below
+                }
+            }
+            auto const num = classify_number(tok);
+            if(num.kind == number_token::string) throw error("is not a number");
+            // an int is exact as double
+            double const d =
+                num.kind == number_token::integer ? double(num.i) : num.d;
+            if constexpr(std::is_same<T, bool>::value)
+                return d != 0;
+            else if constexpr(std::is_integral<T>::value) {
+                using lim = std::numeric_limits<T>;
+                if(std::trunc(d) != d) throw error("is not an integer");
+                // max + 1 is a power of two, i.e. exact
+                if(!(d >= double(lim::min()) and d < double(lim::max()) + 1))
+                    throw error("is out of range");
+                return static_cast<T>(d);
+            } else {
+                using lim = std::numeric_limits<T>;
+                if(std::isfinite(d) and
+                   (d > double(lim::max()) or d < double(lim::lowest())))
+                    throw error("is out of range");
+                return static_cast<T>(d);
+            }
+        }
+    }
+}  // end namespace detail
+}  // end namespace fsc
+/// \endcond
+
+#endif  // FSC_NUMBER_TOKEN_HEADER
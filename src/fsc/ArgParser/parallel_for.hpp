@@ -0,0 +1,121 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    parallel_for.hpp
+
+#ifndef FSC_PARALLEL_FOR_HEADER
+#define FSC_PARALLEL_FOR_HEADER
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace fsc {
+namespace detail {
+    /** @brief calls `f(worker, i)` for all `i < n` on `threads` threads
+     *
+     * Every worker starts with an equal share of the indices and takes
+     * `chunk` of them at a time from the front of its share. A worker that
+     * runs out steals the back half of the largest remaining share, i.e. a
+     * few slow items do not leave the other threads idle. `worker` is in
+     * [0, threads) and can index per-thread state. The caller is worker 0.
+     *
+     * If `f` throws, the remaining items are skipped and the first
+     * exception is rethrown.
+     */
+    template <typename F>
+    void parallel_for(std::size_t const &n, unsigned threads, F &&f,
+                      std::size_t const &chunk = 16) {
+        threads = unsigned(std::max<std::size_t>(
+            1, std::min<std::size_t>(threads, (n + chunk - 1) / chunk)));
+        if(threads == 1) {
+            for(std::size_t i = 0; i < n; ++i) f(0u, i);
+            return;
+        }
+        struct share {
+            std::mutex m;
+            std::size_t begin;
+            std::size_t end;
+        };
+        std::unique_ptr<share[]> shares(new share[threads]);
+        for(unsigned t = 0; t < threads; ++t) {
+            shares[t].begin = n * t / threads;
+            shares[t].end = n * (t + 1) / threads;
+        }
+        std::mutex error_m;
+        std::exception_ptr error;
+        std::atomic<bool> failed(false);
+
+        // takes the next items of the own share, else steals
+        auto const next = [&](unsigned const &w, std::size_t &first,
+                              std::size_t &last) {
+            {
+                auto &own = shares[w];
+                std::lock_guard<std::mutex> lock(own.m);
+                if(own.begin < own.end) {
+                    first = own.begin;
+                    last = std::min(own.end, first + chunk);
+                    own.begin = last;
+                    return true;
+                }
+            }
+            while(true) {
+                unsigned victim = threads;
+                std::size_t most = 0;
+                for(unsigned t = 0; t < threads; ++t) {
+                    std::lock_guard<std::mutex> lock(shares[t].m);
+                    auto const left = shares[t].end - shares[t].begin;
+                    if(left > most) {
+                        most = left;
+                        victim = t;
+                    }
+                }
+                if(victim == threads) return false;
+                std::size_t end;
+                {
+                    auto &v = shares[victim];
+                    std::lock_guard<std::mutex> lock(v.m);
+                    if(v.begin == v.end) continue;  // taken in the meantime
+                    first = v.begin + (v.end - v.begin) / 2;
+                    end = v.end;
+                    v.end = first;
+                }
+                last = std::min(end, first + chunk);
+                // the rest of the stolen half is ours, never two locks
+                std::lock_guard<std::mutex> lock(shares[w].m);
+                shares[w].begin = last;
+                shares[w].end = end;
+                return true;
+            }
+        };
+        auto const work = [&](unsigned const &w) {
+            std::size_t first, last;
+            try {
+                while(next(w, first, last)) {
+                    for(auto i = first; i < last; ++i) f(w, i);
+                    if(failed) return;
+                }
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(error_m);
+                if(!failed) error = std::current_exception();
+                failed = true;
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for(unsigned t = 1; t < threads; ++t) pool.emplace_back(work, t);
+        work(0);
+        for(auto &th : pool) th.join();
+        if(error) std::rethrow_exception(error);
+    }
+}  // end namespace detail
+}  // end namespace fsc
+/// \endcond
+
+#endif  // FSC_PARALLEL_FOR_HEADER
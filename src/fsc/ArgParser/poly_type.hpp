@@ -5,23 +5,37 @@
 #ifndef FSC_POLY_TYPE_HEADER
 #define FSC_POLY_TYPE_HEADER
 
-#include "boost_any.hpp"
 #include "fsc_except.hpp"
+#include "number_token.hpp"
 
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <stdexcept>
 #include <type_traits>
+#include <string>
+#include <string_view>
 #include <typeinfo>
+#include <utility>
 
 /* TODO:
  * default ctor in reject conv
  */
 
 namespace fsc {
+struct poly_type;
 /// @cond NEVER_DOCUMENT_THIS_ENTITY
 namespace detail {
+    // the types a poly_type can be built from, everything else is left to
+    // other overloads (e.g. iterator arithmetic must not pick up the
+    // poly_type operators below)
+    template <typename T>
+    using enable_if_storable_t = std::enable_if_t<
+        !std::is_base_of<poly_type, T>::value and
+        (std::is_arithmetic<T>::value or
+         std::is_convertible<T const &, std::string>::value)>;
+
     template <typename T>
     struct convert {
         template <typename U>
@@ -88,155 +102,406 @@ private:
 
 public:
     //------------------- structors -------------------
-    poly_type() {}
-    template <typename T>
-    poly_type(T const &t) : any(t) {}
-    poly_type(char const *t) : any(std::string(t)) {}
+    poly_type() noexcept : tag_(tag::empty) {}
+    template <typename T, typename = detail::enable_if_storable_t<T>>
+    poly_type(T const &t) : tag_(tag::empty) {
+        set_(t);
+    }
+    poly_type(char const *t) : tag_(tag::empty) { set_(std::string(t)); }
+    poly_type(poly_type const &rhs) : tag_(tag::empty) { copy_(rhs); }
+    poly_type(poly_type &&rhs) noexcept : tag_(tag::empty) {
+        move_(std::move(rhs));
+    }
+    ~poly_type() { reset_(); }
     //------------------- cast -------------------
     template <typename T,
               typename enable = std::enable_if_t<drop_casts<T, void>::value>>
     operator T() const {
-        if(type() == typeid(int)) {
-            return detail::convert<T>::from(boost::any_cast<int>(any));
-        }
-        if(type() == typeid(double)) {
-            return detail::convert<T>::from(boost::any_cast<double>(any));
-        }
-        if(type() == typeid(bool)) {
-            return detail::convert<T>::from(boost::any_cast<bool>(any));
+        resolve_();
+        switch(tag_) {
+            case(tag::integer):
+                return detail::convert<T>::from(i_);
+            case(tag::floating):
+                return detail::convert<T>::from(d_);
+            case(tag::boolean):
+                return detail::convert<T>::from(b_);
+            case(tag::string):
+                return detail::convert<T>::from(s_);
+            default:
+                return T();
         }
-        if(type() == typeid(std::string)) {
-            return detail::convert<T>::from(boost::any_cast<std::string>(any));
-        }
-        return T();
     }
     //------------------- assign -------------------
-    template <typename T>
+    template <typename T, typename = detail::enable_if_storable_t<T>>
     void operator=(T const &t) {
-        any = t;
+        set_(t);
     }
     void operator=(
         const char *t) {  // handle spaecial case since "bla" is not a string
-        any = std::string(t);
+        set_(std::string(t));
+    }
+    void operator=(poly_type const &t) {
+        if(this != &t) copy_(t);
+    }
+    void operator=(poly_type &&t) noexcept {
+        if(this != &t) move_(std::move(t));
     }
-    void operator=(poly_type const &t) { any = t.any; }
 
     //------------------- += -= *= /= operator -------------------
-    template <typename T>
+    template <typename T, typename = detail::enable_if_storable_t<T>>
     poly_type &operator+=(T const &t) {
         return (*this) += poly_type(t);
     }
     poly_type &operator+=(char const *t) { return (*this) += std::string(t); }
     poly_type &operator+=(poly_type const &t) {
-        if(type() == typeid(std::string)) {
-            std::string as = (*this);
+        resolve_();
+        t.resolve_();
+        if(tag_ == tag::string) {
             std::string bs = t;
-            any = as + bs;
-        } else if(type() == typeid(double) or t.type() == typeid(double)) {
+            s_ += bs;
+        } else if(tag_ == tag::floating or t.tag_ == tag::floating) {
             double as = (*this);
             double bs = t;
-            any = as + bs;
+            set_(as + bs);
         } else {
             int as = (*this);
             int bs = t;
-            any = as + bs;
+            set_(as + bs);
         }
         return (*this);
     }
 
-    template <typename T>
+    template <typename T, typename = detail::enable_if_storable_t<T>>
     poly_type &operator-=(T const &t) {
         return (*this) -= poly_type(t);
     }
     poly_type &operator-=(poly_type const &t) {
-        if(type() == typeid(double) or t.type() == typeid(double)) {
+        resolve_();
+        t.resolve_();
+        if(tag_ == tag::floating or t.tag_ == tag::floating) {
             double as = (*this);
             double bs = t;
-            any = as - bs;
+            set_(as - bs);
         } else {
             int as = (*this);
             int bs = t;
-            any = as - bs;
+            set_(as - bs);
         }
         return (*this);
     }
 
-    template <typename T>
+    template <typename T, typename = detail::enable_if_storable_t<T>>
     poly_type &operator*=(T const &t) {
         return (*this) *= poly_type(t);
     }
     poly_type &operator*=(poly_type const &t) {
-        if(type() == typeid(double) or t.type() == typeid(double)) {
+        resolve_();
+        t.resolve_();
+        if(tag_ == tag::floating or t.tag_ == tag::floating) {
             double as = (*this);
             double bs = t;
-            any = as * bs;
+            set_(as * bs);
         } else {
             int as = (*this);
             int bs = t;
-            any = as * bs;
+            set_(as * bs);
         }
         return (*this);
     }
 
-    template <typename T>
+    template <typename T, typename = detail::enable_if_storable_t<T>>
     poly_type &operator/=(T const &t) {
         return (*this) /= poly_type(t);
     }
     poly_type &operator/=(poly_type const &t) {
         double as = (*this);
         double bs = t;
-        any = as / bs;
+        set_(as / bs);
         return (*this);
     }
 
+    //------------------- compare -------------------
+    // typed equality, i.e. the int 1 is not the double 1.0 and not the
+    // string "1". Raw values are classified first.
+    bool operator==(poly_type const &rhs) const {
+        resolve_();
+        rhs.resolve_();
+        if(tag_ != rhs.tag_) return false;
+        switch(tag_) {
+            case(tag::boolean):
+                return b_ == rhs.b_;
+            case(tag::integer):
+                return i_ == rhs.i_;
+            case(tag::floating):
+                return d_ == rhs.d_;
+            case(tag::string):
+                return s_ == rhs.s_;
+            default:
+                return true;
+        }
+    }
+    bool operator!=(poly_type const &rhs) const { return !(*this == rhs); }
+    template <typename T, typename = detail::enable_if_storable_t<T>>
+    bool operator==(T const &t) const {
+        return *this == poly_type(t);
+    }
+    template <typename T, typename = detail::enable_if_storable_t<T>>
+    bool operator!=(T const &t) const {
+        return !(*this == poly_type(t));
+    }
+
     //------------------- const fct -------------------
-    std::type_info const &type() const { return any.type(); }
+    std::type_info const &type() const {
+        resolve_();
+        switch(tag_) {
+            case(tag::boolean):
+                return typeid(bool);
+            case(tag::integer):
+                return typeid(int);
+            case(tag::floating):
+                return typeid(double);
+            case(tag::string):
+                return typeid(std::string);
+            default:
+                return typeid(void);
+        }
+    }
     template <typename S>
     void print(S &os) const {
-        if(type() == typeid(bool)) {
-            os << boost::any_cast<bool>(any);
+        resolve_();
+        switch(tag_) {
+            case(tag::boolean):
+                os << b_;
+                break;
+            case(tag::integer):
+                os << i_;
+                break;
+            case(tag::floating):
+                os << d_;
+                break;
+            case(tag::string):
+                os << s_;
+                break;
+            default:
+                break;
+        }
+    }
+
+protected:
+    // see lazy_poly_type
+    void set_raw_(std::string_view tok) noexcept {
+        reset_();
+        r_ = tok;
+        tag_ = tag::raw;
+    }
+
+private:
+    // the value lives inline, only strings longer than the small string
+    // buffer of std::string touch the heap. A `raw` value is a view of a
+    // token that has not been classified yet, resolve_() turns it into an
+    // integer, floating or string on first access or copy.
+    enum class tag : unsigned char {
+        empty,
+        boolean,
+        integer,
+        floating,
+        string,
+        raw
+    };
+
+    void resolve_() const {
+        if(tag_ != tag::raw) return;
+        auto const tok = r_;
+        auto const num = detail::classify_number(tok);
+        switch(num.kind) {
+            case(detail::number_token::integer):
+                i_ = num.i;
+                tag_ = tag::integer;
+                break;
+            case(detail::number_token::floating):
+                d_ = num.d;
+                tag_ = tag::floating;
+                break;
+            default:
+                new(&s_) std::string(tok);
+                tag_ = tag::string;
+                break;
+        }
+    }
+    void reset_() noexcept {
+        if(tag_ == tag::string) s_.~basic_string();
+        tag_ = tag::empty;
+    }
+    void set_(bool const &t) noexcept {
+        reset_();
+        b_ = t;
+        tag_ = tag::boolean;
+    }
+    void set_(int const &t) noexcept {
+        reset_();
+        i_ = t;
+        tag_ = tag::integer;
+    }
+    void set_(double const &t) noexcept {
+        reset_();
+        d_ = t;
+        tag_ = tag::floating;
+    }
+    void set_(std::string const &t) {
+        if(tag_ == tag::string) {
+            s_ = t;
+        } else {
+            reset_();
+            new(&s_) std::string(t);
+            tag_ = tag::string;
         }
-        if(type() == typeid(int)) {
-            os << boost::any_cast<int>(any);
+    }
+    void set_(std::string &&t) noexcept {
+        if(tag_ == tag::string) {
+            s_ = std::move(t);
+        } else {
+            reset_();
+            new(&s_) std::string(std::move(t));
+            tag_ = tag::string;
         }
-        if(type() == typeid(double)) {
-            os << boost::any_cast<double>(any);
+    }
+    // all other integral and floating point types are widened/narrowed to
+    // the two arithmetic types that poly_type knows about, an integer that
+    // does not fit into an int is rejected instead of wrapped around
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value> set_(T const &t) {
+        using lim = std::numeric_limits<int>;
+        bool fits = true;  // all smaller types fit
+        if constexpr(sizeof(T) >= sizeof(int)) {
+            fits = t <= T(lim::max());
+            if constexpr(std::is_signed<T>::value)
+                fits = fits and t >= T(lim::min());
         }
-        if(type() == typeid(std::string)) {
-            os << boost::any_cast<std::string>(any);
+        if(!fits)
+            throw fsc::O__o("poly_type error: " + std::to_string(t) +
+                            " does not fit into an int");
+        set_(static_cast<int>(t));
+    }
+    template <typename T>
+    std::enable_if_t<std::is_floating_point<T>::value> set_(
+        T const &t) noexcept {
+        set_(static_cast<double>(t));
+    }
+    template <typename T>
+    std::enable_if_t<!std::is_arithmetic<T>::value> set_(T const &t) {
+        set_(std::string(t));
+    }
+    // a copy never refers to the token of a raw value
+    void copy_(poly_type const &rhs) {
+        rhs.resolve_();
+        switch(rhs.tag_) {
+            case(tag::boolean):
+                set_(rhs.b_);
+                break;
+            case(tag::integer):
+                set_(rhs.i_);
+                break;
+            case(tag::floating):
+                set_(rhs.d_);
+                break;
+            case(tag::string):
+                set_(rhs.s_);
+                break;
+            default:
+                reset_();
+                break;
         }
     }
+    void move_(poly_type &&rhs) noexcept {
+        if(rhs.tag_ == tag::string) {
+            set_(std::move(rhs.s_));
+            rhs.reset_();
+        } else if(rhs.tag_ == tag::raw) {  // stays unclassified
+            set_raw_(rhs.r_);
+            rhs.reset_();
+        } else
+            copy_(rhs);
+    }
 
-private:
-    boost::any any;
+    // mutable since resolve_() classifies a raw token in const accessors
+    union {
+        mutable bool b_;
+        mutable int i_;
+        mutable double d_;
+        mutable std::string s_;
+        std::string_view r_;
+    };
+    mutable tag tag_;
 };
 
-std::ostream &operator<<(std::ostream &os, poly_type const &arg) {
+/** @brief a poly_type that classifies parsed tokens on first access
+ *
+ * `fsc::ArgParserTpl<fsc::lazy_poly_type> ap(argc, argv);` keeps every
+ * parsed value as a view of the raw token, the ArgParser owns the bytes.
+ * Only when a value is read (cast, `type()`, printing, arithmetic) or
+ * copied it is decided if it is an int, a double or a std::string. The
+ * result is cached in place and is the same as for fsc::poly_type, so
+ * parsing a large config is cheap if only a few keys are read.
+ *
+ * The first read of a value writes to it, i.e. reading the same value
+ * concurrently from several threads needs a synchronization, or a
+ * fsc::poly_type.
+ */
+struct lazy_poly_type : public poly_type {
+    using poly_type::poly_type;
+    using poly_type::operator=;
+    lazy_poly_type() = default;
+    lazy_poly_type(poly_type const &rhs) : poly_type(rhs) {}
+    lazy_poly_type(poly_type &&rhs) noexcept : poly_type(std::move(rhs)) {}
+    /**@brief a value that refers to `tok` and classifies it on first access
+     *
+     * The token becomes an int, a double or a std::string like a parsed
+     * argument does. It is not copied, i.e. it has to outlive the value
+     * or be read or copied before it dies.
+     */
+    static lazy_poly_type from_token(std::string_view tok) {
+        lazy_poly_type res;
+        res.set_raw_(tok);
+        return res;
+    }
+};
+
+inline std::ostream &operator<<(std::ostream &os, poly_type const &arg) {
     arg.print(os);
     return os;
 }
 
-#define FSC_POLY_TYPE_OP_SUPPORT(OP)                                \
-    poly_type operator OP(poly_type const &a, poly_type const &b) { \
-        poly_type res(a);                                           \
-        res OP## = b;                                               \
-        return res;                                                 \
-    }                                                               \
-    template <typename T>                                           \
-    poly_type operator OP(poly_type const &p, T const &t) {         \
-        return p OP poly_type(t);                                   \
-    }                                                               \
-    template <typename T>                                           \
-    poly_type operator OP(T const &t, poly_type const &p) {         \
-        return poly_type(t) OP p;                                   \
+#define FSC_POLY_TYPE_OP_SUPPORT(OP)                                  \
+    inline poly_type operator OP(poly_type const &a,                  \
+                                 poly_type const &b) {                \
+        poly_type res(a);                                             \
+        res OP## = b;                                                 \
+        return res;                                                   \
+    }                                                                 \
+    template <typename T, typename = detail::enable_if_storable_t<T>> \
+    poly_type operator OP(poly_type const &p, T const &t) {           \
+        return p OP poly_type(t);                                     \
+    }                                                                 \
+    template <typename T, typename = detail::enable_if_storable_t<T>> \
+    poly_type operator OP(T const &t, poly_type const &p) {           \
+        return poly_type(t) OP p;                                     \
     }  //
 
-#define FSC_POLY_TYPE_OPEQ_SUPPORT(OP, TYPE)              \
-    TYPE &operator OP(TYPE &a, fsc::poly_type const &b) { \
-        TYPE t = b;                                       \
-        return a OP t;                                    \
+#define FSC_POLY_TYPE_OPEQ_SUPPORT(OP, TYPE)                     \
+    inline TYPE &operator OP(TYPE &a, fsc::poly_type const &b) { \
+        TYPE t = b;                                              \
+        return a OP t;                                           \
     }  //
 
+template <typename T, typename = detail::enable_if_storable_t<T>>
+bool operator==(T const &t, poly_type const &p) {
+    return p == t;
+}
+template <typename T, typename = detail::enable_if_storable_t<T>>
+bool operator!=(T const &t, poly_type const &p) {
+    return p != t;
+}
+
 FSC_POLY_TYPE_OP_SUPPORT(+)
 FSC_POLY_TYPE_OP_SUPPORT(-)
 FSC_POLY_TYPE_OP_SUPPORT(/)
@@ -0,0 +1,350 @@
+// Author:  agent
+// Date:    18.10.2026
+// File:    tokenizer.hpp
+
+#ifndef FSC_TOKENIZER_HEADER
+#define FSC_TOKENIZER_HEADER
+
+#include "fsc_except.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace fsc {
+namespace detail {
+    inline bool is_space(char const &c) noexcept {
+        return c == ' ' or (c >= '\t' and c <= '\r');
+    }
+    inline bool is_special(char const &c) noexcept {
+        return is_space(c) or c == '\'' or c == '"' or c == '\\';
+    }
+
+    enum class simd { scalar, sse2, avx2 };
+#if defined(__AVX2__)
+    constexpr simd best_simd = simd::avx2;
+#elif defined(__SSE2__)
+    constexpr simd best_simd = simd::sse2;
+#else
+    constexpr simd best_simd = simd::scalar;
+#endif
+
+    /* classify<S>(p, space, squote, dquote) sets bit i of `space` if p[i]
+     * is white-space, of `squote` if p[i] is a `'` and of `dquote` if p[i]
+     * is a `"` or a backslash, for 64 readable bytes at p. A byte is
+     * special if any of its bits is set.
+     */
+    template <simd S>
+    void classify(char const *p, std::uint64_t &space, std::uint64_t &squote,
+                  std::uint64_t &dquote) noexcept;
+
+#if defined(__SSE2__)
+    template <>
+    inline void classify<simd::sse2>(char const *p, std::uint64_t &space,
+                                     std::uint64_t &squote,
+                                     std::uint64_t &dquote) noexcept {
+        space = squote = dquote = 0;
+        for(int i = 0; i < 64; i += 16) {
+            __m128i const v =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+            // '\t' ... '\r' as one unsigned range
+            __m128i const x = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+            __m128i const sp = _mm_or_si128(
+                _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(4)), x),
+                _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+            __m128i const sq = _mm_cmpeq_epi8(v, _mm_set1_epi8('\''));
+            __m128i const dq =
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\')),
+                             _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+            space |= std::uint64_t(unsigned(_mm_movemask_epi8(sp))) << i;
+            squote |= std::uint64_t(unsigned(_mm_movemask_epi8(sq))) << i;
+            dquote |= std::uint64_t(unsigned(_mm_movemask_epi8(dq))) << i;
+        }
+    }
+#endif
+
+#if defined(__AVX2__)
+    template <>
+    inline void classify<simd::avx2>(char const *p, std::uint64_t &space,
+                                     std::uint64_t &squote,
+                                     std::uint64_t &dquote) noexcept {
+        space = squote = dquote = 0;
+        for(int i = 0; i < 64; i += 32) {
+            __m256i const v =
+                _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+            __m256i const x = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+            __m256i const sp = _mm256_or_si256(
+                _mm256_cmpeq_epi8(_mm256_min_epu8(x, _mm256_set1_epi8(4)), x),
+                _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+            __m256i const sq = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\''));
+            __m256i const dq =
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')),
+                                _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+            space |= std::uint64_t(unsigned(_mm256_movemask_epi8(sp))) << i;
+            squote |= std::uint64_t(unsigned(_mm256_movemask_epi8(sq))) << i;
+            dquote |= std::uint64_t(unsigned(_mm256_movemask_epi8(dq))) << i;
+        }
+    }
+#endif
+
+    /* scanner<S>::skip_space(p) returns the first non white-space character
+     * in [p, end), scanner<S>::find_special(p) the first white-space, quote
+     * or backslash, find_squote(p) the first `'` and find_dquote(p) the
+     * first `"` or backslash. All return end if there is none.
+     *
+     * The vectorized scanners classify the input in blocks of 64 bytes and
+     * keep the bit masks of the current block, i.e. most tokens and quotes
+     * are found with a few bit operations and without touching the bytes
+     * again.
+     */
+    template <simd S>
+    class scanner {
+    public:
+        scanner(char const *begin, char const *end) noexcept
+            : begin_(begin), end_(end), blk_(begin) {
+            if(begin_ != end_) classify_();
+        }
+
+        char const *skip_space(char const *p) noexcept {
+            return find_(p, [this]() { return ~space_; });
+        }
+        char const *find_special(char const *p) noexcept {
+            return find_(p, [this]() { return special_; });
+        }
+        char const *find_squote(char const *p) noexcept {
+            return find_(p, [this]() { return squote_; });
+        }
+        char const *find_dquote(char const *p) noexcept {
+            return find_(p, [this]() { return dquote_; });
+        }
+
+    private:
+        template <typename Mask>
+        char const *find_(char const *p, Mask const &mask) noexcept {
+            while(p < end_) {
+                load_(p);
+                std::uint64_t const m = mask() >> (p - blk_);
+                if(m) return std::min(p + __builtin_ctzll(m), end_);
+                p = blk_ + 64;
+            }
+            return end_;
+        }
+        void load_(char const *p) noexcept {
+            if(std::size_t(p - blk_) < 64) return;
+            blk_ = begin_ + ((p - begin_) & ~std::ptrdiff_t(63));
+            classify_();
+        }
+        void classify_() noexcept {
+            if(end_ - blk_ >= 64)
+                classify<S>(blk_, space_, squote_, dquote_);
+            else {  // the tail is padded with white-space
+                char pad[64];
+                std::memset(pad, ' ', 64);
+                std::memcpy(pad, blk_, end_ - blk_);
+                classify<S>(pad, space_, squote_, dquote_);
+            }
+            special_ = space_ | squote_ | dquote_;
+        }
+        char const *const begin_;
+        char const *const end_;
+        char const *blk_;  // start of the current block
+        std::uint64_t space_ = 0;
+        std::uint64_t squote_ = 0;
+        std::uint64_t dquote_ = 0;
+        std::uint64_t special_ = 0;
+    };
+
+    template <>
+    class scanner<simd::scalar> {
+    public:
+        scanner(char const *, char const *end) noexcept : end_(end) {}
+
+        char const *skip_space(char const *p) const noexcept {
+            while(p != end_ and is_space(*p)) ++p;
+            return p;
+        }
+        char const *find_special(char const *p) const noexcept {
+            while(p != end_ and !is_special(*p)) ++p;
+            return p;
+        }
+        char const *find_squote(char const *p) const noexcept {
+            auto const *q =
+                static_cast<char const *>(std::memchr(p, '\'', end_ - p));
+            return q ? q : end_;
+        }
+        char const *find_dquote(char const *p) const noexcept {
+            while(p != end_ and *p != '"' and *p != '\\') ++p;
+            return p;
+        }
+
+    private:
+        char const *const end_;
+    };
+
+    /** @brief splits a command line into tokens like a shell would
+     *
+     * * tokens are separated by white-space
+     * * `'...'` quotes everything literally
+     * * `"..."` quotes everything, except that `\"` and `\\` are escaped
+     *   and a backslash-newline is removed
+     * * outside of quotes a backslash escapes the next character and a
+     *   backslash-newline is removed
+     * * quoted and unquoted parts next to each other form one token,
+     *   e.g. `--name="foo bar"`
+     *
+     * Tokens without quotes or backslashes are views into the input, all
+     * others are unescaped into a buffer owned by the tokenizer. All tokens
+     * stay valid as long as the input and the tokenizer live.
+     * Throws a fsc::cat_on_your_keyboard_error on an unterminated quote.
+     */
+    template <simd S = best_simd>
+    class basic_tokenizer {
+    public:
+        /// single pass iterator over the tokens
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::string_view const *;
+            using reference = std::string_view const &;
+
+            iterator() = default;  // end
+            explicit iterator(basic_tokenizer *t) : t_(t) { ++(*this); }
+            reference operator*() const noexcept { return tok_; }
+            pointer operator->() const noexcept { return &tok_; }
+            iterator &operator++() {
+                if(!t_->next_(tok_)) t_ = nullptr;
+                return *this;
+            }
+            bool operator==(iterator const &rhs) const noexcept {
+                return t_ == rhs.t_;
+            }
+            bool operator!=(iterator const &rhs) const noexcept {
+                return t_ != rhs.t_;
+            }
+
+        private:
+            basic_tokenizer *t_ = nullptr;
+            std::string_view tok_;
+        };
+
+        explicit basic_tokenizer(std::string_view str) noexcept
+            : begin_(str.data()),
+              pos_(str.data()),
+              end_(str.data() + str.size()),
+              scan_(pos_, end_) {}
+        /// unescapes into `buf` if it is large enough, see release()
+        basic_tokenizer(std::string_view str, std::string buf) noexcept
+            : basic_tokenizer(str) {
+            if(buf.capacity() < str.size()) return;
+            buf_ = std::move(buf);
+        }
+        basic_tokenizer(basic_tokenizer const &) = delete;
+        basic_tokenizer &operator=(basic_tokenizer const &) = delete;
+
+        iterator begin() { return iterator(this); }
+        iterator end() noexcept { return iterator(); }
+        /// returns the buffer for the next tokenizer, invalidates the tokens
+        std::string release() noexcept {
+            used_ = 0;
+            return std::move(buf_);
+        }
+
+    private:
+        char const *skip_space_(char const *p) noexcept {
+            while(true) {
+                p = scan_.skip_space(p);
+                // a backslash-newline between tokens is removed
+                if(end_ - p < 2 or p[0] != '\\' or p[1] != '\n') return p;
+                p += 2;
+            }
+        }
+        bool next_(std::string_view &tok) {
+            char const *const start = skip_space_(pos_);
+            if(start == end_) return false;
+
+            char const *p = scan_.find_special(start);
+            if(p == end_ or is_space(*p)) {  // nothing to unescape
+                tok = std::string_view(start, p - start);
+                pos_ = p;
+                return true;
+            }
+
+            // the unescaped tokens are never longer than the input, i.e.
+            // the buffer is sized once and the views into it stay valid
+            if(buf_.size() < std::size_t(end_ - begin_))
+                buf_.resize(end_ - begin_);
+            char *const out = &buf_[used_];
+            char *o = out;
+            auto const copy = [&o](char const *first, char const *last) {
+                std::memcpy(o, first, std::size_t(last - first));
+                o += last - first;
+            };
+            copy(start, p);
+            while(p != end_ and !is_space(*p)) {
+                if(*p == '\\') {
+                    if(++p == end_) {
+                        *o++ = '\\';
+                        break;
+                    }
+                    if(*p != '\n') *o++ = *p;
+                    ++p;
+                } else if(*p == '\'') {
+                    char const *const q = scan_.find_squote(p + 1);
+                    if(q == end_) unterminated_('\'');
+                    copy(p + 1, q);
+                    p = q + 1;
+                } else if(*p == '"') {
+                    for(++p;;) {
+                        char const *const q = scan_.find_dquote(p);
+                        copy(p, q);
+                        if(q == end_) unterminated_('"');
+                        p = q + 1;
+                        if(*q == '"') break;
+                        // only \", \\ and \newline are escapes
+                        if(p == end_) continue;
+                        if(*p == '"' or *p == '\\')
+                            *o++ = *p++;
+                        else if(*p == '\n')
+                            ++p;
+                        else
+                            *o++ = '\\';
+                    }
+                } else {
+                    char const *const q = scan_.find_special(p);
+                    copy(p, q);
+                    p = q;
+                }
+            }
+            tok = std::string_view(out, std::size_t(o - out));
+            used_ += tok.size();
+            pos_ = p;
+            return true;
+        }
+        [[noreturn]] void unterminated_(char const &quote) const {
+            throw cat_on_your_keyboard_error(
+                std::string("ArgParser error: unterminated quote ") + quote);
+        }
+
+        char const *const begin_;
+        char const *pos_;
+        char const *const end_;
+        scanner<S> scan_;
+        std::string buf_;  // sized to the input on the first unescape
+        std::size_t used_ = 0;
+    };
+    using tokenizer = basic_tokenizer<>;
+}  // end namespace detail
+}  // end namespace fsc
+/// \endcond
+
+#endif  // FSC_TOKENIZER_HEADER
@@ -0,0 +1,181 @@
+/** ****************************************************************************
+ *
+ * \file       ArgParserBatch.hpp
+ * \brief      Parse many files or buffers in parallel.
+ * >           One ArgParser or one error per input, in the order of the
+ * inputs.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_ARGPARSER_BATCH_HEADER
+#define FSC_ARGPARSER_BATCH_HEADER
+
+#include "ArgParser.hpp"
+#include "ArgParser/mapped_file.hpp"
+#include "ArgParser/parallel_for.hpp"
+
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace fsc {
+/** @brief the result of parsing one input of a batch
+ */
+template <typename P>
+struct batch_result {
+    std::optional<P> args;  ///< the parsed arguments, empty on error
+    std::string error;      ///< why the input could not be parsed
+
+    explicit operator bool() const noexcept { return args.has_value(); }
+};
+
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    inline unsigned batch_threads(unsigned const &threads) noexcept {
+        if(threads) return threads;
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+    template <typename P, typename... Res>
+    void parse_into(batch_result<P> &res, std::string_view content,
+                    Res... mem) {
+        try {
+            res.args.emplace(content, mem...);
+        } catch(std::exception const &e) {
+            res.error = e.what();
+        }
+    }
+    // `parse(res, content, w)` parses in thread w
+    template <typename P, typename Parse>
+    std::vector<batch_result<P>> parse_files(
+        std::vector<std::string> const &filenames, unsigned const &n,
+        Parse const &parse) {
+        std::vector<batch_result<P>> res(filenames.size());
+        std::vector<mapped_file> buffers(n);
+        parallel_for(filenames.size(), n, [&](unsigned w, std::size_t i) {
+            auto &file = buffers[w];
+            if(!file.read(filenames[i]))
+                res[i].error =
+                    "ArgParser error: cannot read '" + filenames[i] + "'";
+            else
+                parse(res[i], file.view(), w);
+        });
+        return res;
+    }
+}  // end namespace detail
+/// @endcond
+
+/**@brief one memory pool per thread of a batch
+ *
+ * The parsers of a batch that is parsed with pools allocate from the pool of
+ * the thread that parsed them, i.e. the threads never contend for the
+ * global heap and the memory of a batch is released in one step with the
+ * pools. The pools have to outlive the parsers. They are not synchronized:
+ * the parsers of one batch must not allocate or free memory (set, merge,
+ * destruction, ...) in several threads at the same time, reading them
+ * concurrently is fine.
+ *
+ * `fsc::batch_pools pools;`\n
+ * `auto jobs = fsc::parse_files(paths, pools);`
+ */
+class batch_pools {
+public:
+    /// `threads` pools, 0 for one per core
+    explicit batch_pools(unsigned const &threads = 0) {
+        auto const n = detail::batch_threads(threads);
+        pools_.reserve(n);
+        for(unsigned w = 0; w < n; ++w)
+            pools_.push_back(
+                std::make_unique<std::pmr::unsynchronized_pool_resource>());
+    }
+    /// the number of pools, i.e. of threads that parse a batch
+    unsigned threads() const noexcept { return unsigned(pools_.size()); }
+    /// the pool of thread `w`
+    std::pmr::memory_resource *operator[](unsigned const &w) const noexcept {
+        return pools_[w].get();
+    }
+
+private:
+    std::vector<std::unique_ptr<std::pmr::unsynchronized_pool_resource>>
+        pools_;
+};
+
+/**@brief parse the files `filenames` in parallel
+ * @param filenames are the files, one ArgParser each
+ * @param threads is the number of threads, 0 for one per core
+ *
+ * The result `i` is the same as `P ap; ap.parse_file(filenames[i]);`, or
+ * holds the error if the file cannot be read or is ill-formed. The files
+ * are distributed over a work stealing thread pool, every thread reads its
+ * files into its own buffer that is reused for the next file.
+ *
+ * `auto jobs = fsc::parse_files(paths);`\n
+ * `for(auto const &job : jobs) if(job) run(*job.args);`
+ */
+template <typename P = ArgParser>
+std::vector<batch_result<P>> parse_files(
+    std::vector<std::string> const &filenames, unsigned const &threads = 0) {
+    return detail::parse_files<P>(
+        filenames, detail::batch_threads(threads),
+        [](batch_result<P> &res, std::string_view content, unsigned) {
+            detail::parse_into(res, content);
+        });
+}
+/**@brief parse the files `filenames` in parallel, allocate from `pools`
+ *
+ * Same as above with one thread per pool, the parser of a file allocates
+ * from the pool of the thread that parsed it, see fsc::batch_pools.
+ */
+template <typename P = ArgParser>
+std::vector<batch_result<P>> parse_files(
+    std::vector<std::string> const &filenames, batch_pools const &pools) {
+    return detail::parse_files<P>(
+        filenames, pools.threads(),
+        [&pools](batch_result<P> &res, std::string_view content, unsigned w) {
+            detail::parse_into(res, content, pools[w]);
+        });
+}
+
+/**@brief parse the buffers `contents` in parallel
+ * @param contents are the buffers, one ArgParser each
+ * @param threads is the number of threads, 0 for one per core
+ *
+ * The result `i` is the same as `P ap(contents[i]);`, or holds the error
+ * if the buffer is ill-formed.
+ */
+template <typename P = ArgParser>
+std::vector<batch_result<P>> parse_buffers(
+    std::vector<std::string_view> const &contents,
+    unsigned const &threads = 0) {
+    std::vector<batch_result<P>> res(contents.size());
+    detail::parallel_for(contents.size(), detail::batch_threads(threads),
+                         [&](unsigned, std::size_t i) {
+                             detail::parse_into(res[i], contents[i]);
+                         });
+    return res;
+}
+/**@brief parse the buffers `contents` in parallel, allocate from `pools`
+ *
+ * Same as above with one thread per pool, see fsc::batch_pools.
+ */
+template <typename P = ArgParser>
+std::vector<batch_result<P>> parse_buffers(
+    std::vector<std::string_view> const &contents, batch_pools const &pools) {
+    std::vector<batch_result<P>> res(contents.size());
+    detail::parallel_for(contents.size(), pools.threads(),
+                         [&](unsigned w, std::size_t i) {
+                             detail::parse_into(res[i], contents[i], pools[w]);
+                         });
+    return res;
+}
+
+}  // end namespace fsc
+#endif  // FSC_ARGPARSER_BATCH_HEADER
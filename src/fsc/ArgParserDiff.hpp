@@ -0,0 +1,261 @@
+/** ****************************************************************************
+ *
+ * \file       ArgParserDiff.hpp
+ * \brief      Differences between two ArgParsers.
+ * >           diff() returns what changed between two parses,
+ * ChangeNotifier calls back the subscribers of the changed keys.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_ARGPARSER_DIFF_HEADER
+#define FSC_ARGPARSER_DIFF_HEADER
+
+#include "ArgParser.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace fsc {
+/** @brief a named argument or flag that differs between two parsers
+ */
+struct key_change {
+    enum kind_type {
+        added,    ///< only in the new parser
+        removed,  ///< only in the old parser
+        changed   ///< in both, with a different value
+    };
+    std::string key;
+    kind_type kind;
+    bool flag;  ///< true if `key` is a flag (in the parser that has it)
+};
+
+/** @brief all differences between two parsers, see fsc::diff
+ */
+struct change_set {
+    std::vector<key_change> keys;  ///< named arguments and flags
+    /// positions of the free arguments that differ, incl. the ones that
+    /// exist only in one of the parsers
+    std::vector<std::size_t> free;
+
+    bool empty() const noexcept { return keys.empty() and free.empty(); }
+};
+
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    // the flags of `ap`, taken from flags() and not looked up with is_set,
+    // which would count as an access of an instrumented parser
+    template <typename P>
+    std::unordered_set<std::string_view> flag_set(P const &ap) {
+        std::unordered_set<std::string_view> res;
+        for(auto const &it : ap.flags()) res.insert(it);
+        return res;
+    }
+}  // end namespace detail
+/// @endcond
+
+/**@brief returns the differences from `lhs` (old) to `rhs` (new)
+ *
+ * Values are compared with the `operator==` of the value type, i.e. typed
+ * for fsc::poly_type: the int 1 and the double 1.0 differ. With
+ * fsc::ordered_keys the named arguments are walked as two sorted sequences
+ * in one pass and reported sorted by key, with fsc::hashed_keys every key
+ * is looked up once. A key that turns from a flag into a named argument is
+ * reported as removed flag and added named argument.
+ */
+template <typename VT, typename SP, typename IP>
+change_set diff(ArgParserTpl<VT, SP, IP> const &lhs,
+                ArgParserTpl<VT, SP, IP> const &rhs) {
+    change_set res;
+    auto const &l = lhs.n_args();
+    auto const &r = rhs.n_args();
+    auto const add = [&res](auto const &key, key_change::kind_type kind,
+                            bool const &flag) {
+        res.keys.push_back(key_change{std::string(key), kind, flag});
+    };
+    //------------------- named arguments -------------------
+    if constexpr(std::is_same<SP, ordered_keys>::value) {
+        auto li = l.begin();
+        auto ri = r.begin();
+        while(li != l.end() or ri != r.end()) {
+            if(ri == r.end() or (li != l.end() and li->first < ri->first)) {
+                add(li->first, key_change::removed, false);
+                ++li;
+            } else if(li == l.end() or ri->first < li->first) {
+                add(ri->first, key_change::added, false);
+                ++ri;
+            } else {
+                if(!(li->second == ri->second))
+                    add(li->first, key_change::changed, false);
+                ++li;
+                ++ri;
+            }
+        }
+    } else {
+        for(auto const &it : l) {
+            auto const other = r.find(it.first);
+            if(other == r.end())
+                add(it.first, key_change::removed, false);
+            else if(!(it.second == other->second))
+                add(it.first, key_change::changed, false);
+        }
+        for(auto const &it : r)
+            if(l.find(it.first) == l.end())
+                add(it.first, key_change::added, false);
+    }
+    //------------------- flags -------------------
+    auto const lflags = detail::flag_set(lhs);
+    auto const rflags = detail::flag_set(rhs);
+    for(auto const &it : lhs.flags())
+        if(!rflags.count(it)) add(it, key_change::removed, true);
+    for(auto const &it : rhs.flags())
+        if(!lflags.count(it)) add(it, key_change::added, true);
+    //------------------- free arguments -------------------
+    auto const n = std::max(lhs.freeargc(), rhs.freeargc());
+    for(std::size_t i = 0; i < n; ++i)
+        if(!lhs.is_set(i) or !rhs.is_set(i) or !(lhs[i] == rhs[i]))
+            res.free.push_back(i);
+    return res;
+}
+
+/** @brief calls back subscribers of the keys that changed
+ *
+ * `fsc::ChangeNotifier notify;`\n
+ * `notify.subscribe("threads", [&](fsc::key_change const &) { ... });`\n
+ * `notify(old_ap, new_ap);  // calls the callbacks of the changed keys`
+ *
+ * A callback of a key is called once per call of notify() if the key was
+ * added, removed or changed, see fsc::diff. Free argument subscribers are
+ * called once with all positions that changed.
+ *
+ * A callback may subscribe and unsubscribe (itself as well). A subscriber
+ * that is added while notifying is called from the next notification on,
+ * one that is removed is not called anymore.
+ */
+class ChangeNotifier {
+public:
+    using key_callback = std::function<void(key_change const &)>;
+    using free_callback = std::function<void(std::vector<std::size_t> const &)>;
+    using id_type = std::uint64_t;  ///< identifies a subscription
+
+    //------------------- modifier -------------------
+    /**@brief call `f` when the named argument or flag `key` changes
+     *
+     * Returns an id for unsubscribe().
+     */
+    id_type subscribe(std::string_view key, key_callback f) {
+        purge_();
+        auto &subs = keys_[std::string(key)];
+        subs.push_back(entry<key_callback>{next_id_, std::move(f)});
+        return next_id_++;
+    }
+    /**@brief call `f` when a free argument changes
+     */
+    id_type subscribe_free(free_callback f) {
+        purge_();
+        free_.push_back(entry<free_callback>{next_id_, std::move(f)});
+        return next_id_++;
+    }
+    /**@brief remove a subscription, returns false if `id` is unknown
+     */
+    bool unsubscribe(id_type const &id) {
+        purge_();
+        if(erase_(free_, id)) return true;
+        for(auto it = keys_.begin(); it != keys_.end(); ++it)
+            if(erase_(it->second, id)) {
+                if(it->second.empty() and !depth_) keys_.erase(it);
+                return true;
+            }
+        return false;
+    }
+
+    //------------------- notify -------------------
+    /**@brief call the subscribers of the changes in `changes`
+     */
+    void operator()(change_set const &changes) const {
+        // the callbacks may change the subscribers: the deques keep the
+        // entries in place and removals are deferred, see purge_()
+        struct guard {
+            std::size_t &depth;
+            explicit guard(std::size_t &d) noexcept : depth(++d) {}
+            ~guard() { --depth; }
+        } const g(depth_);
+        for(auto const &change : changes.keys) {
+            auto const it = keys_.find(change.key);
+            if(it == keys_.end()) continue;
+            auto const &subs = it->second;
+            for(std::size_t i = 0, n = subs.size(); i < n; ++i)
+                if(!subs[i].dead) subs[i].f(change);
+        }
+        if(!changes.free.empty())
+            for(std::size_t i = 0, n = free_.size(); i < n; ++i)
+                if(!free_[i].dead) free_[i].f(changes.free);
+    }
+    /**@brief call the subscribers of the changes from `lhs` to `rhs`
+     *
+     * Returns the changes, see fsc::diff.
+     */
+    template <typename VT, typename SP, typename IP>
+    change_set operator()(ArgParserTpl<VT, SP, IP> const &lhs,
+                          ArgParserTpl<VT, SP, IP> const &rhs) const {
+        auto res = diff(lhs, rhs);
+        (*this)(res);
+        return res;
+    }
+
+private:
+    template <typename F>
+    struct entry {
+        id_type id;
+        F f;
+        bool dead = false;
+    };
+    // while notifying, an entry is only marked dead (its callback may be
+    // running) and removed by the next purge_()
+    template <typename V>
+    bool erase_(V &subs, id_type const &id) {
+        for(auto it = subs.begin(); it != subs.end(); ++it)
+            if(it->id == id and !it->dead) {
+                if(depth_) {
+                    it->dead = true;
+                    purge_pending_ = true;
+                } else
+                    subs.erase(it);
+                return true;
+            }
+        return false;
+    }
+    void purge_() {
+        if(depth_ or !purge_pending_) return;
+        auto const dead = [](auto const &e) { return e.dead; };
+        free_.erase(std::remove_if(free_.begin(), free_.end(), dead),
+                    free_.end());
+        for(auto it = keys_.begin(); it != keys_.end();) {
+            auto &subs = it->second;
+            subs.erase(std::remove_if(subs.begin(), subs.end(), dead),
+                       subs.end());
+            it = subs.empty() ? keys_.erase(it) : std::next(it);
+        }
+        purge_pending_ = false;
+    }
+
+    std::map<std::string, std::deque<entry<key_callback>>, std::less<>> keys_;
+    std::deque<entry<free_callback>> free_;
+    id_type next_id_ = 0;
+    mutable std::size_t depth_ = 0;  // nesting of notifications
+    bool purge_pending_ = false;
+};
+
+}  // end namespace fsc
+#endif  // FSC_ARGPARSER_DIFF_HEADER
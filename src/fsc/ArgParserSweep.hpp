@@ -0,0 +1,265 @@
+/** ****************************************************************************
+ *
+ * \file       ArgParserSweep.hpp
+ * \brief      Parameter sweeps over ranges and lists of values.
+ * >           Iterates the cartesian product of all swept named arguments
+ * without building it.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_ARGPARSER_SWEEP_HEADER
+#define FSC_ARGPARSER_SWEEP_HEADER
+
+#include "ArgParser.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fsc {
+/** @brief all combinations of the swept named arguments of an ArgParser
+ *
+ * A named argument is swept if its value is enclosed in `[...]` and is
+ *
+ * * a range `[start:stop:step]` or `[start:stop]` (step 1) of numbers, the
+ *   `stop` is included if it is hit, e.g. `--mcs [1000:100000:1000]`. If
+ *   all three are integers the values are integers, else doubles.
+ * * a list of values separated by `,`, e.g. `T=[0.5,1.0,2.0]`, the values
+ *   are classified like parsed arguments. A list can have a single value.
+ *
+ * All other values are left as they are, e.g. `host=a,b`, `out=x,y.txt`
+ * or `t=10:30`. A shell may expand `[...]`, quote such values.
+ *
+ * `fsc::ArgParserSweep sweep(fsc::ArgParser(argc, argv));`\n
+ * `fsc::ArgParser job = sweep.at(job_array_index);`
+ *
+ * The combinations are never stored. Combination `k` is computed from `k`
+ * directly (the last swept key varies fastest), i.e. at() costs the same for
+ * every `k`, plus the copy of the base parser. Iterating yields one
+ * ArgParser per combination, with the swept keys set to their values.
+ *
+ * The sweep syntax only applies to an ArgParserSweep, a plain ArgParser
+ * keeps these values as strings.
+ */
+template <typename VT = poly_type, typename SP = ordered_keys,
+          typename IP = uninstrumented>
+class ArgParserSweepTpl {
+public:
+    /// the type of a combination
+    using parser_type = ArgParserTpl<VT, SP, IP>;
+    using size_type = std::size_t;
+
+    /**@brief one swept key and its values
+     */
+    struct dimension {
+        std::string key;
+        size_type size;  ///< the number of values
+        enum kind_type { range, list } kind;
+
+    private:
+        friend class ArgParserSweepTpl;
+        bool integer = false;  // range of integers
+        double start = 0;
+        double step = 0;
+        std::vector<std::string> items;  // list
+    };
+
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = parser_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = parser_type;
+
+        parser_type operator*() const { return sweep_->at(k_); }
+        iterator &operator++() noexcept {
+            ++k_;
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            auto res = *this;
+            ++k_;
+            return res;
+        }
+        bool operator==(iterator const &rhs) const noexcept {
+            return k_ == rhs.k_;
+        }
+        bool operator!=(iterator const &rhs) const noexcept {
+            return k_ != rhs.k_;
+        }
+        /// the number of the combination
+        size_type index() const noexcept { return k_; }
+
+    private:
+        friend class ArgParserSweepTpl;
+        iterator(ArgParserSweepTpl const *sweep, size_type const &k) noexcept
+            : sweep_(sweep), k_(k) {}
+        ArgParserSweepTpl const *sweep_;
+        size_type k_;
+    };
+
+    //------------------- structors -------------------
+    /**@brief find the swept keys of `base`
+     *
+     * Throws a fsc::cat_on_your_keyboard_error if a range is empty, e.g.
+     * `[10:1]`, has a zero step, is not finite, e.g. `[0:inf]`, or has more
+     * values than a size_type can count, and if a `[...]` is neither a
+     * range nor a list, e.g. `[]` or `[1:x]`.
+     */
+    explicit ArgParserSweepTpl(parser_type base) : base_(std::move(base)) {
+        for(auto const &it : base_.n_args()) {
+            if constexpr(std::is_same<VT, std::string>::value)
+                add_(it.first, it.second);
+            else if(it.second.type() == typeid(std::string))
+                add_(it.first, std::string(it.second));
+        }
+        size_ = 1;
+        for(auto const &d : dims_) {
+            if(size_ > std::numeric_limits<size_type>::max() / d.size)
+                throw std::length_error("ArgParser error: sweep too large");
+            size_ *= d.size;
+        }
+    }
+
+    //------------------- const fct -------------------
+    /**@brief returns the number of combinations
+     *
+     * 1 if there are no swept keys.
+     */
+    size_type size() const noexcept { return size_; }
+    /**@brief returns the swept keys, in the order of `n_args()`
+     */
+    std::vector<dimension> const &dims() const noexcept { return dims_; }
+    /**@brief returns the parser without the sweep
+     */
+    parser_type const &base() const noexcept { return base_; }
+    /**@brief returns the combination `k`
+     *
+     * If `k >= size()` a std::out_of_range is thrown.
+     */
+    parser_type at(size_type k) const {
+        if(k >= size_)
+            throw std::out_of_range("ArgParser error: sweep combination '" +
+                                    std::to_string(k) + "' not found");
+        parser_type res(base_);
+        for(auto d = dims_.rbegin(); d != dims_.rend(); ++d) {
+            set_(res, *d, k % d->size);
+            k /= d->size;
+        }
+        return res;
+    }
+    parser_type operator[](size_type const &k) const { return at(k); }
+    iterator begin() const noexcept { return iterator(this, 0); }
+    iterator end() const noexcept { return iterator(this, size_); }
+
+private:
+    static bool number_(std::string_view tok, detail::number_token &num) {
+        num = detail::classify_number(tok);
+        return num.kind != detail::number_token::string;
+    }
+    void add_(std::string_view key, std::string const &val) {
+        // only [...] is swept
+        if(val.size() < 2 or val.front() != '[' or val.back() != ']') return;
+        std::string_view const v(val.data() + 1, val.size() - 2);
+        dimension d;
+        d.key = std::string(key);
+        auto const invalid = [&]() {
+            return cat_on_your_keyboard_error(
+                "ArgParser error: '" + val + "' of '" + d.key +
+                "' is neither a range nor a list");
+        };
+        if(v.empty()) throw invalid();
+        // start:stop or start:stop:step, all numbers
+        auto const c1 = v.find(':');
+        if(c1 == std::string_view::npos or
+           v.find(',') != std::string_view::npos) {
+            d.kind = dimension::list;
+            for(std::size_t pos = 0;;) {
+                auto const end = v.find(',', pos);
+                d.items.emplace_back(v.substr(pos, end - pos));
+                if(end == std::string_view::npos) break;
+                pos = end + 1;
+            }
+            d.size = d.items.size();
+            dims_.push_back(std::move(d));
+            return;
+        }
+        auto const c2 = v.find(':', c1 + 1);
+        detail::number_token start, stop, step;
+        step.kind = detail::number_token::integer;
+        step.i = 1;
+        if(!number_(v.substr(0, c1), start) or
+           !number_(v.substr(c1 + 1, c2 - c1 - 1), stop) or
+           (c2 != std::string_view::npos and !number_(v.substr(c2 + 1), step)))
+            throw invalid();
+        auto const as_double = [](detail::number_token const &n) {
+            return n.kind == detail::number_token::integer ? double(n.i) : n.d;
+        };
+        d.kind = dimension::range;
+        d.integer = start.kind == detail::number_token::integer and
+                    stop.kind == detail::number_token::integer and
+                    step.kind == detail::number_token::integer;
+        d.start = as_double(start);
+        d.step = as_double(step);
+        double const n =
+            d.step == 0 ? -1 : (as_double(stop) - d.start) / d.step;
+        if(!(n >= 0))
+            throw cat_on_your_keyboard_error(
+                "ArgParser error: the range '" + val + "' of '" + d.key +
+                "' is empty");
+        // the stop is included if it is hit up to rounding
+        double const last = n * (1 + 1e-12) + 1e-12;
+        if(!std::isfinite(d.start) or !std::isfinite(d.step) or
+           !(last < double(std::numeric_limits<size_type>::max())))
+            throw cat_on_your_keyboard_error(
+                "ArgParser error: the range '" + val + "' of '" + d.key +
+                "' is not finite or too large");
+        d.size = size_type(last) + 1;
+        dims_.push_back(std::move(d));
+    }
+    static void set_(parser_type &ap, dimension const &d, size_type const &j) {
+        if(d.kind == dimension::list) {
+            auto const &item = d.items[j];
+            detail::number_token num;
+            if constexpr(std::is_same<VT, std::string>::value)
+                ap.set(d.key, item);
+            else if(!number_(item, num))
+                ap.set(d.key, item);
+            else if(num.kind == detail::number_token::integer)
+                ap.set(d.key, num.i);
+            else
+                ap.set(d.key, num.d);
+        } else if(d.integer) {
+            // start and stop are ints, but j * step may not be
+            auto const val = std::int64_t(d.start) +
+                             std::int64_t(j) * std::int64_t(d.step);
+            if(val < std::numeric_limits<int>::min() or
+               val > std::numeric_limits<int>::max())
+                throw cat_on_your_keyboard_error(
+                    "ArgParser error: the value " + std::to_string(val) +
+                    " of '" + d.key + "' does not fit into an int");
+            ap.set(d.key, int(val));
+        } else
+            ap.set(d.key, d.start + double(j) * d.step);
+    }
+
+    parser_type base_;
+    std::vector<dimension> dims_;
+    size_type size_;
+};
+
+using ArgParserSweep = ArgParserSweepTpl<>;
+
+}  // end namespace fsc
+#endif  // FSC_ARGPARSER_SWEEP_HEADER
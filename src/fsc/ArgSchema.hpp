@@ -0,0 +1,353 @@
+/** ****************************************************************************
+ *
+ * \file       ArgSchema.hpp
+ * \brief      Keys that are registered at runtime.
+ * >           Their values are stored unboxed in typed slots that are
+ * accessed by index, all other arguments go to an ArgParser.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_ARGSCHEMA_HEADER
+#define FSC_ARGSCHEMA_HEADER
+
+#include "ArgParser.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fsc {
+/** @brief the handle of a key of a fsc::Schema with values of type `T`
+ *
+ * `T` is bool (a flag), int, double or std::string.
+ */
+template <typename T>
+struct slot_id {
+    static_assert(std::is_same<T, bool>::value or
+                      std::is_same<T, int>::value or
+                      std::is_same<T, double>::value or
+                      std::is_same<T, std::string>::value,
+                  "Schema error: a slot holds a bool, an int, a double or a "
+                  "std::string");
+    std::uint32_t index;  ///< among the slots of type `T`
+    std::uint32_t slot;   ///< among all slots, in the order of add()
+    std::uint64_t schema;  ///< the tag of the schema that returned it
+};
+
+/** @brief keys and their types, registered at runtime
+ *
+ * `fsc::Schema schema;`\n
+ * `auto const temp = schema.add<double>("T");`\n
+ * `auto const slow = schema.add<bool>("slow");  // a flag`\n
+ * `fsc::SchemaArgParser ap(schema, argc, argv);`\n
+ * `double T = ap.slot(temp);  // an index into an array of doubles`
+ *
+ * Every type has its own dense index, i.e. the values of a parser are
+ * stored in one contiguous array per type. The schema has to outlive the
+ * parsers that use it, keys must not be added once there are parsers.
+ */
+class Schema {
+public:
+    //------------------- structors -------------------
+    Schema() = default;
+    Schema(Schema const &) = delete;
+    Schema &operator=(Schema const &) = delete;
+    Schema(Schema &&) = default;
+    Schema &operator=(Schema &&) = default;
+
+    //------------------- modifier -------------------
+    /**@brief register the key `name` with values of type `T`
+     *
+     * `bool` registers a flag. Throws a fsc::cat_on_your_keyboard_error if
+     * `name` is already registered.
+     */
+    template <typename T>
+    slot_id<T> add(std::string_view name) {
+        if(entries_.find(name) != entries_.end())
+            throw cat_on_your_keyboard_error("Schema error: the key '" +
+                                             std::string(name) +
+                                             "' is registered twice");
+        auto const t = type_of_<T>();
+        slot_id<T> res{counts_[t]++, std::uint32_t(entries_.size()), tag_};
+        entries_.insert(keys_.store(name), entry{t, res.index});
+        return res;
+    }
+
+    //------------------- const fct -------------------
+    /**@brief returns the handle of the key `name`
+     *
+     * Throws a std::runtime_error if `name` is not registered or not of
+     * type `T`.
+     */
+    template <typename T>
+    slot_id<T> id(std::string_view name) const {
+        auto const it = entries_.find(name);
+        if(it == entries_.end() or it->second.type != type_of_<T>())
+            throw std::runtime_error("Schema error: no key '" +
+                                     std::string(name) + "' of this type");
+        return slot_id<T>{it->second.index,
+                          std::uint32_t(it - entries_.begin()), tag_};
+    }
+    /**@brief returns true if `name` is registered
+     */
+    bool contains(std::string_view name) const noexcept {
+        return entries_.find(name) != entries_.end();
+    }
+    /**@brief returns the number of keys
+     */
+    std::size_t size() const noexcept { return entries_.size(); }
+    /**@brief returns the name of the key in slot `slot`, see slot_id
+     */
+    std::string_view name(std::uint32_t const &slot) const noexcept {
+        return (entries_.begin() + slot)->first;
+    }
+
+private:
+    template <typename P>
+    friend class SchemaArgParserTpl;
+
+    enum type_tag : std::uint32_t { flag_t, int_t, double_t, string_t };
+    struct entry {
+        type_tag type;
+        std::uint32_t index;
+    };
+    static std::uint64_t new_tag_() noexcept {
+        static std::atomic<std::uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+    template <typename T>
+    static constexpr type_tag type_of_() noexcept {
+        if constexpr(std::is_same<T, bool>::value)
+            return flag_t;
+        else if constexpr(std::is_same<T, int>::value)
+            return int_t;
+        else if constexpr(std::is_same<T, double>::value)
+            return double_t;
+        else
+            return string_t;
+    }
+
+    detail::key_arena keys_;
+    detail::flat_hash_map<entry> entries_;  // in the order of add()
+    std::uint32_t counts_[4] = {0, 0, 0, 0};
+    std::uint64_t tag_ = new_tag_();  // tells the ids of schemas apart
+};
+
+/** @brief a parser that writes the keys of a fsc::Schema into typed slots
+ *
+ * While parsing, every named argument and flag is looked up in the schema
+ * once, the values of its keys are converted once and stored unboxed.
+ * Access by fsc::slot_id is an index into an array, without hashing or
+ * casts. Everything else, i.e. unknown keys and the free arguments, goes
+ * to the ArgParser `P`, see dynamic().
+ *
+ * A flag of the schema is never followed by a value, i.e. in `--slow
+ * input.txt` `input.txt` is a free argument. A value that cannot be
+ * converted to the type of its key, a key that is given as flag and a flag
+ * with a value (`--slow=1`) throw a fsc::cat_on_your_keyboard_error.
+ * Overwrites are reported to the diagnostics of the dynamic parser.
+ */
+template <typename P = ArgParser>
+class SchemaArgParserTpl {
+    template <typename T>
+    using return_type =
+        std::conditional_t<std::is_same<T, std::string>::value, T const &, T>;
+
+public:
+    using parser_type = P;  ///< the type of the dynamic parser
+
+    //------------------- structors -------------------
+    /**@brief no arguments, `schema` has to outlive `this`
+     */
+    explicit SchemaArgParserTpl(Schema const &schema)
+        : schema_(&schema),
+          set_(schema.size()),
+          flags_(schema.counts_[Schema::flag_t]),
+          ints_(schema.counts_[Schema::int_t]),
+          doubles_(schema.counts_[Schema::double_t]),
+          strings_(schema.counts_[Schema::string_t]) {}
+    /**@brief construct from command line
+     *
+     * See the command line constructor of fsc::ArgParser.
+     */
+    SchemaArgParserTpl(Schema const &schema, int const &argc, char *argv[])
+        : SchemaArgParserTpl(schema) {
+        dynamic_.paths_.set_argv0(argv[0]);
+        dynamic_.parse_(argv + 1, argv + argc, hook_{this});
+    }
+    /**@brief string constructor
+     *
+     * See the string constructor of fsc::ArgParser.
+     */
+    SchemaArgParserTpl(Schema const &schema, std::string_view cline)
+        : SchemaArgParserTpl(schema) {
+        detail::tokenizer tok(cline);
+        dynamic_.parse_(tok.begin(), tok.end(), hook_{this});
+    }
+
+    //------------------- const fct -------------------
+    /**@brief returns true if the key `id` was given
+     *
+     * False for an id that is not a slot of `this`, i.e. one that was added
+     * to the schema after `this` was constructed or one of another schema.
+     */
+    template <typename T>
+    bool is_set(slot_id<T> const &id) const noexcept {
+        return in_range_(id) and set_[id.slot];
+    }
+    /**@brief returns the value of the key `id`
+     *
+     * For a flag, true if it is set. For a named argument that is not set,
+     * a std::runtime_error is thrown. For an id that is not a slot of
+     * `this` (see is_set()), a std::out_of_range is thrown.
+     */
+    template <typename T>
+    return_type<T> slot(slot_id<T> const &id) const {
+        check_(id);
+        if constexpr(!std::is_same<T, bool>::value)
+            if(!set_[id.slot])
+                throw std::runtime_error(
+                    "ArgParser error: named argument '" +
+                    std::string(schema_->name(id.slot)) + "' not found");
+        return values_<T>()[id.index];
+    }
+    /**@brief returns the value of the key `id` or `def` if it is not set
+     */
+    template <typename T>
+    T slot(slot_id<T> const &id, T const &def) const {
+        return is_set(id) ? T(values_<T>()[id.index]) : def;
+    }
+    /**@brief returns the schema of `this`
+     */
+    Schema const &schema() const noexcept { return *schema_; }
+    /**@brief returns the parser of the free arguments and of the keys that
+     * are not in the schema
+     */
+    parser_type const &dynamic() const noexcept { return dynamic_; }
+
+    //------------------- modifier -------------------
+    /**@brief sets the value of the key `id`, without warning
+     *
+     * For an id that is not a slot of `this`, a std::out_of_range is
+     * thrown.
+     */
+    template <typename T>
+    void set(slot_id<T> const &id, T val) {
+        check_(id);
+        values_<T>()[id.index] = std::move(val);
+        set_[id.slot] = true;
+    }
+    parser_type &dynamic() noexcept { return dynamic_; }
+
+private:
+    struct hook_ {
+        SchemaArgParserTpl *self;
+        bool named(std::string_view key, std::string_view raw) const {
+            return self->assign_(key, raw);
+        }
+        bool flag(std::string_view key) const {
+            return self->assign_(key, std::string_view());
+        }
+        bool is_flag(std::string_view key) const noexcept {
+            auto const &entries = self->schema_->entries_;
+            auto const it = entries.find(key);
+            return it != entries.end() and it->second.type == Schema::flag_t;
+        }
+        bool free_arg(std::string_view) const noexcept { return false; }
+    };
+    // a flag has no raw value (nullptr)
+    bool assign_(std::string_view key, std::string_view raw) {
+        auto const it = schema_->entries_.find(key);
+        if(it == schema_->entries_.end()) return false;
+        auto const slot = std::size_t(it - schema_->entries_.begin());
+        auto const &e = it->second;
+        bool const is_flag = raw.data() == nullptr;
+        if(is_flag != (e.type == Schema::flag_t))
+            throw cat_on_your_keyboard_error(
+                "ArgParser error: '" + std::string(key) +
+                (is_flag ? "' needs a value"
+                         : "' is a flag and cannot have a value"));
+        auto &diag = dynamic_.get_diagnostics();
+        auto const store = [&](auto &values) {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+            T val = detail::convert_token<T>(key, raw);
+            if(set_[slot]) diag.overwrite(key, values[e.index], val);
+            values[e.index] = std::move(val);
+        };
+        switch(e.type) {
+            case(Schema::flag_t):
+                if(set_[slot]) diag.flag_twice(key);
+                flags_[e.index] = true;
+                break;
+            case(Schema::int_t):
+                store(ints_);
+                break;
+            case(Schema::double_t):
+                store(doubles_);
+                break;
+            default:
+                store(strings_);
+                break;
+        }
+        set_[slot] = true;
+        return true;
+    }
+    // ids of another schema have another tag, ids of keys that were added
+    // after `this` was constructed are out of the range of the slots
+    template <typename T>
+    bool in_range_(slot_id<T> const &id) const noexcept {
+        return id.schema == schema_->tag_ and id.slot < set_.size() and
+               id.index < values_<T>().size();
+    }
+    template <typename T>
+    void check_(slot_id<T> const &id) const {
+        if(!in_range_(id))
+            throw std::out_of_range("Schema error: the slot '" +
+                                    std::to_string(id.slot) +
+                                    "' is not in the parser");
+    }
+    template <typename T>
+    auto const &values_() const noexcept {
+        if constexpr(std::is_same<T, bool>::value)
+            return flags_;
+        else if constexpr(std::is_same<T, int>::value)
+            return ints_;
+        else if constexpr(std::is_same<T, double>::value)
+            return doubles_;
+        else
+            return strings_;
+    }
+    template <typename T>
+    auto &values_() noexcept {
+        if constexpr(std::is_same<T, bool>::value)
+            return flags_;
+        else if constexpr(std::is_same<T, int>::value)
+            return ints_;
+        else if constexpr(std::is_same<T, double>::value)
+            return doubles_;
+        else
+            return strings_;
+    }
+
+    Schema const *schema_;
+    std::vector<char> set_;    // per slot
+    std::vector<char> flags_;  // no std::vector<bool>, one byte per flag
+    std::vector<int> ints_;
+    std::vector<double> doubles_;
+    std::vector<std::string> strings_;
+    parser_type dynamic_;
+};
+
+using SchemaArgParser = SchemaArgParserTpl<>;
+
+}  // end namespace fsc
+#endif  // FSC_ARGSCHEMA_HEADER
@@ -0,0 +1,326 @@
+/** ****************************************************************************
+ *
+ * \file       ArgSpec.hpp
+ * \brief      Keys that are known at compile time.
+ * >           Their values are stored unboxed in fixed slots, all other
+ * arguments go to an ArgParser.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_ARGSPEC_HEADER
+#define FSC_ARGSPEC_HEADER
+
+#include "ArgParser.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fsc {
+/** @brief base of a named argument of a fsc::ArgSpecTpl with a value of
+ * type `T`
+ *
+ * `T` is an arithmetic type or std::string. The key itself is a type with
+ * the name as `static constexpr std::string_view name`:
+ *
+ * `struct mcs : fsc::key<int> { static constexpr std::string_view name =
+ * "mcs"; };`
+ */
+template <typename T>
+struct key {
+    static_assert(std::is_arithmetic<T>::value or
+                      std::is_same<T, std::string>::value,
+                  "ArgSpec error: a key holds an arithmetic type or a "
+                  "std::string");
+    using type = T;
+    static constexpr bool is_flag = false;
+};
+/** @brief base of a flag of a fsc::ArgSpecTpl, see fsc::key
+ */
+struct flag {
+    using type = bool;
+    static constexpr bool is_flag = true;
+};
+
+/// @cond NEVER_DOCUMENT_THIS_ENTITY
+namespace detail {
+    // FNV-1a with a final mix, usable in constant expressions
+    constexpr std::uint64_t spec_hash(std::string_view key) noexcept {
+        std::uint64_t h = 0xcbf29ce484222325ull;
+        for(char const c : key) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ull;
+        }
+        return h ^ (h >> 31);
+    }
+
+    /* a perfect hash of N names: slot(key) = (spec_hash(key) * mul) >>
+     * (64 - bits) is different for every name. Found at compile time by
+     * trying multipliers, with a table of at least 2N slots that grows if
+     * no multiplier works.
+     */
+    struct perfect_hash_params {
+        unsigned bits = 0;
+        std::uint64_t mul = 0;
+    };
+    template <std::size_t N>
+    constexpr perfect_hash_params find_perfect_hash(
+        std::array<std::string_view, N> const &names) {
+        std::array<std::uint64_t, N> h{};
+        for(std::size_t i = 0; i < N; ++i) h[i] = spec_hash(names[i]);
+        unsigned bits = 1;
+        while((std::size_t(1) << bits) < 2 * N) ++bits;
+        for(unsigned const max = bits + 4; bits < max; ++bits) {
+            for(std::uint64_t k = 0; k < 1024; ++k) {
+                std::uint64_t const mul = (2 * k + 1) * 0x9e3779b97f4a7c15ull;
+                std::array<bool, 32 * N + 2> used{};
+                bool ok = true;
+                for(std::size_t i = 0; ok and i < N; ++i) {
+                    auto const slot = (h[i] * mul) >> (64 - bits);
+                    ok = !used[slot];
+                    used[slot] = true;
+                }
+                if(ok) return perfect_hash_params{bits, mul};
+            }
+        }
+        return perfect_hash_params{};  // bits == 0: not found
+    }
+
+    constexpr std::size_t perfect_slot(std::string_view key,
+                                       perfect_hash_params const &p) noexcept {
+        return (spec_hash(key) * p.mul) >> (64 - p.bits);
+    }
+    // slot -> index of the name, -1 if empty
+    template <std::size_t M, std::size_t N>
+    constexpr std::array<int, M> make_perfect_table(
+        std::array<std::string_view, N> const &names,
+        perfect_hash_params const &p) {
+        std::array<int, M> res{};
+        for(auto &it : res) it = -1;
+        for(std::size_t i = 0; i < N; ++i)
+            res[perfect_slot(names[i], p)] = int(i);
+        return res;
+    }
+    template <std::size_t N>
+    constexpr bool unique_names(std::array<std::string_view, N> const &names) {
+        for(std::size_t i = 0; i < N; ++i)
+            for(std::size_t j = 0; j < i; ++j)
+                if(names[i] == names[j]) return false;
+        return true;
+    }
+
+    // the names of the keys and their perfect hash table
+    template <typename... Keys>
+    struct spec_table {
+        static constexpr std::size_t N = sizeof...(Keys);
+        static constexpr std::array<std::string_view, N> names = {
+            Keys::name...};
+        static_assert(unique_names<N>(names),
+                      "ArgSpec error: the key names are not unique");
+        static constexpr perfect_hash_params hash = find_perfect_hash<N>(names);
+        static_assert(N == 0 or hash.bits != 0,
+                      "ArgSpec error: no perfect hash found for the names");
+        static constexpr auto table =
+            make_perfect_table<std::size_t(1) << hash.bits, N>(names, hash);
+
+        static constexpr int index_of(std::string_view key) noexcept {
+            if constexpr(N == 0)
+                return -1;
+            else {
+                int const i = table[perfect_slot(key, hash)];
+                return i >= 0 and names[i] == key ? i : -1;
+            }
+        }
+    };
+}  // end namespace detail
+/// @endcond
+
+/** @brief a parser with keys that are known at compile time
+ *
+ * The keys are types derived from fsc::key or fsc::flag:
+ *
+ * `struct mcs : fsc::key<int> { static constexpr std::string_view name =
+ * "mcs"; };`\n
+ * `struct slow : fsc::flag { static constexpr std::string_view name =
+ * "slow"; };`\n
+ * `fsc::ArgSpec<mcs, slow> spec(argc, argv);`\n
+ * `int n = spec.get<mcs>();  // a member load, no lookup`
+ *
+ * While parsing, every named argument and flag is looked up in a perfect
+ * hash of the keys that is computed at compile time, the values of keys
+ * are converted once and stored unboxed in a std::tuple. Everything else,
+ * i.e. unknown keys and the free arguments, goes to the ArgParser `P`, see
+ * dynamic().
+ *
+ * A flag of the spec is never followed by a value, i.e. in `--slow
+ * input.txt` `input.txt` is a free argument. A value that cannot be
+ * converted to the type of its key, a key that is given as flag and a flag
+ * with a value (`--slow=1`) throw a fsc::cat_on_your_keyboard_error.
+ * Overwrites are reported to the diagnostics of the dynamic parser.
+ */
+template <typename P, typename... Keys>
+class ArgSpecTpl {
+    using table_type = detail::spec_table<Keys...>;
+    static constexpr std::size_t N = sizeof...(Keys);
+    static constexpr std::array<bool, N> is_flag_ = {Keys::is_flag...};
+
+    template <typename K, std::size_t I = 0>
+    static constexpr std::size_t index_() {
+        if constexpr(I == N) {
+            static_assert(I < N, "ArgSpec error: the key is not in the spec");
+            return N;
+        } else if constexpr(std::is_same<K, std::tuple_element_t<
+                                                I, std::tuple<Keys...>>>::value)
+            return I;
+        else
+            return index_<K, I + 1>();
+    }
+
+public:
+    using parser_type = P;  ///< the type of the dynamic parser
+    using size_type = std::size_t;
+
+    //------------------- structors -------------------
+    /**@brief no arguments
+     */
+    ArgSpecTpl() = default;
+    /**@brief construct from command line
+     *
+     * See the command line constructor of fsc::ArgParser.
+     */
+    ArgSpecTpl(int const &argc, char *argv[]) {
+        dynamic_.paths_.set_argv0(argv[0]);
+        dynamic_.parse_(argv + 1, argv + argc, hook_{this});
+    }
+    /**@brief string constructor
+     *
+     * See the string constructor of fsc::ArgParser.
+     */
+    explicit ArgSpecTpl(std::string_view cline) {
+        detail::tokenizer tok(cline);
+        dynamic_.parse_(tok.begin(), tok.end(), hook_{this});
+    }
+
+    //------------------- const fct -------------------
+    /**@brief returns the number of keys
+     */
+    static constexpr size_type size() noexcept { return N; }
+    /**@brief returns the index of the key named `key`, -1 if there is none
+     *
+     * One hash and one comparison.
+     */
+    static constexpr int index_of(std::string_view key) noexcept {
+        return table_type::index_of(key);
+    }
+    /**@brief returns true if the key `K` was given
+     */
+    template <typename K>
+    bool is_set() const noexcept {
+        return set_[index_<K>()];
+    }
+    /**@brief returns the value of the key `K`
+     *
+     * For a flag, true if it is set. For a named argument that is not set,
+     * a std::runtime_error is thrown.
+     */
+    template <typename K>
+    typename K::type const &get() const {
+        constexpr auto i = index_<K>();
+        if constexpr(!K::is_flag)
+            if(!set_[i])
+                throw std::runtime_error("ArgParser error: named argument '" +
+                                         std::string(K::name) + "' not found");
+        return std::get<i>(values_);
+    }
+    /**@brief returns the value of the key `K` or `def` if it is not set
+     */
+    template <typename K>
+    typename K::type get(typename K::type const &def) const {
+        constexpr auto i = index_<K>();
+        return set_[i] ? std::get<i>(values_) : def;
+    }
+    /**@brief returns the parser of the free arguments and of the keys that
+     * are not in the spec
+     */
+    parser_type const &dynamic() const noexcept { return dynamic_; }
+
+    //------------------- modifier -------------------
+    /**@brief sets the value of the key `K`, without warning
+     */
+    template <typename K>
+    void set(typename K::type val) {
+        constexpr auto i = index_<K>();
+        std::get<i>(values_) = std::move(val);
+        set_[i] = true;
+    }
+    parser_type &dynamic() noexcept { return dynamic_; }
+
+private:
+    struct hook_ {
+        ArgSpecTpl *self;
+        bool named(std::string_view key, std::string_view raw) const {
+            auto const i = index_of(key);
+            if(i < 0) return false;
+            self->assign_(i, key, raw, std::index_sequence_for<Keys...>());
+            return true;
+        }
+        bool flag(std::string_view key) const {
+            auto const i = index_of(key);
+            if(i < 0) return false;
+            self->assign_(i, key, std::string_view(),
+                          std::index_sequence_for<Keys...>());
+            return true;
+        }
+        bool is_flag(std::string_view key) const noexcept {
+            auto const i = index_of(key);
+            return i >= 0 and is_flag_[std::size_t(i)];
+        }
+        bool free_arg(std::string_view) const noexcept { return false; }
+    };
+    template <std::size_t... I>
+    void assign_(int const &i, std::string_view key, std::string_view raw,
+                 std::index_sequence<I...>) {
+        // compiles to a switch over the index
+        (void)((i == int(I) ? (assign_<I>(key, raw), true) : false) or ...);
+    }
+    template <std::size_t I>
+    void assign_(std::string_view key, std::string_view raw) {
+        using K = std::tuple_element_t<I, std::tuple<Keys...>>;
+        using T = typename K::type;
+        auto &diag = dynamic_.get_diagnostics();
+        bool const is_flag = raw.data() == nullptr;
+        if(is_flag != K::is_flag)
+            throw cat_on_your_keyboard_error(
+                "ArgParser error: '" + std::string(key) +
+                (K::is_flag ? "' is a flag and cannot have a value"
+                            : "' needs a value"));
+        if constexpr(K::is_flag) {
+            if(set_[I]) diag.flag_twice(key);
+            std::get<I>(values_) = true;
+        } else {
+            T val = detail::convert_token<T>(key, raw);
+            if(set_[I]) diag.overwrite(key, std::get<I>(values_), val);
+            std::get<I>(values_) = std::move(val);
+        }
+        set_[I] = true;
+    }
+    std::tuple<typename Keys::type...> values_{};
+    std::bitset<N> set_;
+    parser_type dynamic_;
+};
+
+template <typename... Keys>
+using ArgSpec = ArgSpecTpl<ArgParser, Keys...>;
+
+}  // end namespace fsc
+#endif  // FSC_ARGSPEC_HEADER
@@ -0,0 +1,247 @@
+/** ****************************************************************************
+ *
+ * \file       LayeredArgParser.hpp
+ * \brief      A read-only view of a stack of ArgParsers.
+ * >           Resolves arguments through the layers on access instead of
+ * merging them.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_LAYERED_ARGPARSER_HEADER
+#define FSC_LAYERED_ARGPARSER_HEADER
+
+#include "ArgParser.hpp"
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fsc {
+/** @brief a read-only view of a stack of ArgParsers
+ *
+ * The layers are ordered from the highest to the lowest priority, e.g.
+ * command line, job file, site defaults:
+ *
+ * `fsc::LayeredArgParser lp(cline, job, site);`
+ *
+ * Every access gives the same result as merging the layers from the lowest
+ * to the highest priority with `overwrite == true`, but nothing is copied:
+ *
+ * * a named argument is taken from the highest layer that has it
+ * * a flag is set if it is set in any layer
+ * * free arguments, cwd, pwd and progname are those of the highest layer
+ *
+ * A key that is a flag in one layer and a named argument in another throws
+ * a fsc::cat_on_your_keyboard_error when it is accessed, like merge() does.
+ *
+ * The view only refers to the layers, they have to outlive it. A single
+ * layer can be replaced with set_layer(), e.g. by a reloaded file.
+ */
+template <typename VT = poly_type, typename SP = ordered_keys,
+          typename IP = uninstrumented>
+class LayeredArgParserTpl {
+public:
+    using parser_type = ArgParserTpl<VT, SP, IP>;  ///< the type of the layers
+    using value_type = VT;  ///< the mapped value of the arguments
+    using size_type = typename std::vector<parser_type const *>::size_type;
+
+private:
+    // true if every `P` is a (possibly const) parser_type
+    template <typename... P>
+    using layers_of_ = std::conjunction<
+        std::is_same<std::remove_cv_t<std::remove_reference_t<P>>,
+                     parser_type>...>;
+
+public:
+    //------------------- structors -------------------
+    /**@brief an empty view
+     *
+     * An empty view has no arguments, the special members of an empty view
+     * are not set. Layers are added with push_back().
+     */
+    LayeredArgParserTpl() = default;
+    /**@brief construct from the layers, highest priority first
+     *
+     * The layers have to be lvalues, a view of a temporary does not
+     * compile.
+     */
+    template <typename... P,
+              std::enable_if_t<layers_of_<P...>::value and
+                                   (std::is_lvalue_reference<P>::value and ...),
+                               int> = 0>
+    explicit LayeredArgParserTpl(P &&... layers) : layers_{&layers...} {}
+    // a temporary would not outlive the view, also if only one layer is one
+    template <typename... P,
+              std::enable_if_t<layers_of_<P...>::value and
+                                   !(std::is_lvalue_reference<P>::value and ...),
+                               int> = 0>
+    explicit LayeredArgParserTpl(P &&... layers) = delete;
+
+    //------------------- layers -------------------
+    /**@brief returns the number of layers
+     */
+    size_type layers() const noexcept { return layers_.size(); }
+    /**@brief returns the layer at position `i`, 0 has the highest priority
+     */
+    parser_type const &layer(size_type const &i) const {
+        return *layers_.at(i);
+    }
+    /**@brief replace the layer at position `i`
+     *
+     * If `i >= layers()` a std::out_of_range is thrown.
+     */
+    void set_layer(size_type const &i, parser_type const &layer) {
+        layers_.at(i) = &layer;
+    }
+    void set_layer(size_type const &i, parser_type const &&layer) = delete;
+    /**@brief add a layer with a lower priority than all others
+     */
+    void push_back(parser_type const &layer) { layers_.push_back(&layer); }
+    void push_back(parser_type const &&layer) = delete;
+
+    //------------------- const getter -------------------
+    /**@brief get named argument if set
+     * @param key is the name of the desired named argument
+     *
+     * If `key` is not found in any layer, a std::runtime_error is thrown.
+     */
+    value_type const &operator[](std::string_view key) const {
+        auto const *val = find_(key);
+        record_lookup_(key, val);
+        if(val) return *val;
+        throw std::runtime_error("ArgParser error: named argument '" +
+                                 std::string(key) + "' not found");
+    }
+    /**@brief get free argument of the highest layer if set
+     * @param pos position of the free argument
+     *
+     * If `pos >= freeargc()` a std::runtime_error is thrown.
+     */
+    value_type const &operator[](size_type const &pos) const {
+        if(pos >= freeargc())
+            throw std::runtime_error("ArgParser error: free argument '" +
+                                     std::to_string(pos) + "' not found");
+        return (*layers_.front())[pos];
+    }
+    /**@brief get named argument if set, else a default
+     * @param key name of the named argument
+     * @param def is a default that is returned if `key` is not found
+     */
+    template <typename T>
+    T get(std::string_view key, T const &def) const {
+        auto const *val = find_(key);
+        record_lookup_(key, val);
+        if(val)
+            return *val;
+        else
+            return def;
+    }
+    /**@brief special treatment of `char const *`
+     */
+    std::string get(std::string_view key, char const *def) const {
+        return get<std::string>(key, def);
+    }
+    /**@brief get free argument of the highest layer if set, else a default
+     */
+    template <typename T>
+    T get(size_type const &pos, T const &def) const {
+        if(is_set(pos))
+            return (*layers_.front())[pos];
+        else
+            return def;
+    }
+    /**@brief special treatment of `char const *`
+     */
+    std::string get(size_type const &pos, char const *def) const {
+        return get<std::string>(pos, def);
+    }
+    /**@brief check if flag or named argument is set in any layer
+     * @param key is a named parameter or flag
+     */
+    bool is_set(std::string_view key) const {
+        bool named = false, flag = false;
+        lookup_(key, named, flag);
+        record_lookup_(key, named or flag);
+        return named or flag;
+    }
+    /**@brief check if the highest layer has a free argument at `pos`
+     */
+    bool is_set(size_type const &pos) const noexcept {
+        return pos < freeargc();
+    }
+    /**@brief returns the number of free arguments of the highest layer
+     */
+    size_type freeargc() const noexcept {
+        return layers_.empty() ? 0 : layers_.front()->freeargc();
+    }
+    /**@brief returns the current working directory of the highest layer
+     */
+    std::string const &cwd() const { return top_().cwd(); }
+    /**@brief returns the program working directory of the highest layer
+     */
+    std::string const &pwd() const { return top_().pwd(); }
+    /**@brief returns the program name of the highest layer
+     */
+    std::string const &progname() const { return top_().progname(); }
+
+    /**@brief returns the layers merged into one ArgParser
+     *
+     * The layers are merged from the lowest to the highest priority with
+     * `overwrite == true`.
+     */
+    parser_type merged() const {
+        parser_type res;
+        for(auto it = layers_.rbegin(); it != layers_.rend(); ++it)
+            res.merge(**it);
+        return res;
+    }
+
+private:
+    parser_type const &top_() const {
+        if(layers_.empty())
+            throw std::runtime_error("ArgParser error: no layers");
+        return *layers_.front();
+    }
+    // the value of the highest layer that has `key` as named argument
+    value_type const *lookup_(std::string_view key, bool &named,
+                              bool &flag) const {
+        value_type const *res = nullptr;
+        for(auto const *p : layers_) {
+            auto const &n_args = p->n_args();
+            auto const it = n_args.find(key);
+            if(it != n_args.end()) {
+                if(!res) res = &it->second;
+                named = true;
+            } else if(p->inflag_(key))
+                flag = true;
+            if(named and flag)
+                throw cat_on_your_keyboard_error(
+                    "ArgParser error: there cannot be a flag and named "
+                    "argument with the same name '" +
+                    std::string(key) + "'");
+        }
+        return res;
+    }
+    // one lookup of the view, not one per layer
+    void record_lookup_(std::string_view key, bool const &found) const {
+        if constexpr(IP::enabled) access_stats::global().lookup(key, found);
+    }
+    value_type const *find_(std::string_view key) const {
+        bool named = false, flag = false;
+        return lookup_(key, named, flag);
+    }
+
+    std::vector<parser_type const *> layers_;
+};
+
+using LayeredArgParser = LayeredArgParserTpl<>;
+
+/// \example layered_example.cpp
+
+}  // end namespace fsc
+#endif  // FSC_LAYERED_ARGPARSER_HEADER
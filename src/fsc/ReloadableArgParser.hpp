@@ -0,0 +1,187 @@
+/** ****************************************************************************
+ *
+ * \file       ReloadableArgParser.hpp
+ * \brief      Arguments from a file that is parsed again when it changes.
+ * >           Readers get immutable snapshots that are swapped atomically.
+ * \version    2026.1018
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  See LICENCE
+ */
+
+#ifndef FSC_RELOADABLE_ARGPARSER_HEADER
+#define FSC_RELOADABLE_ARGPARSER_HEADER
+
+#include "ArgParser.hpp"
+#include "ArgParser/file_watcher.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace fsc {
+/** @brief arguments of a file that are updated when the file changes
+ *
+ * The file is parsed with \link fsc::ArgParser::parse_file_buffered
+ * parse_file_buffered \endlink into a copy of a base parser (e.g. the
+ * command line) and published as a fsc::FrozenArgParser. The file is read,
+ * not mapped, i.e. it may be truncated by another process while it is
+ * parsed. A background thread watches the file (inotify on Linux, polling
+ * of the mtime elsewhere) and publishes a new snapshot every time it was
+ * written:
+ *
+ * `fsc::ReloadableArgParser cfg("knobs.txt", fsc::ArgParser(argc, argv));`\n
+ * `auto knobs = cfg.snapshot();  // std::shared_ptr<FrozenArgParser const>`\n
+ * `int n = knobs->get("threads", 4);`
+ *
+ * A snapshot is built completely before it is published with an atomic
+ * pointer swap, i.e. a reader sees either the old or the new arguments,
+ * never a mix. Readers do not wait while a file is parsed and keep their
+ * snapshot alive as long as they hold it. snapshot() is a check of the
+ * generation and a copy of a pointer the thread already holds, only the
+ * first call of a thread after a reload takes a lock, see there.
+ *
+ * `overwrite` is the merge policy of the file against the base: if true
+ * (the default), values of the file overwrite the ones of the base, if
+ * false, the base (e.g. the command line) wins, see
+ * \link fsc::ArgParser::merge merge \endlink. If the file cannot be read or
+ * is ill-formed, the previous snapshot stays published.
+ */
+template <typename VT = poly_type, typename SP = ordered_keys,
+          typename IP = uninstrumented>
+class ReloadableArgParserTpl {
+public:
+    using parser_type = ArgParserTpl<VT, SP, IP>;  ///< the type of the base
+    using snapshot_type = std::shared_ptr<FrozenArgParser const>;
+
+    //------------------- structors -------------------
+    /**@brief parse `filename` and watch it for changes
+     * @param filename is the name of the watched file
+     * @param base holds the arguments the file is merged into
+     * @param overwrite is true if the file overwrites the base on conflict
+     * @param interval between two checks if the file is polled
+     *
+     * The first snapshot is published before the constructor returns. If
+     * the file cannot be read or is ill-formed, it only holds `base`.
+     */
+    explicit ReloadableArgParserTpl(
+        std::string filename, parser_type base = parser_type(),
+        bool const &overwrite = true,
+        std::chrono::milliseconds const &interval =
+            std::chrono::milliseconds(500))
+        : filename_(std::move(filename)),
+          base_(std::move(base)),
+          overwrite_(overwrite),
+          watcher_(filename_, interval) {
+        if(!reload()) publish_(base_);
+        thread_ = std::thread([this]() {
+            while(watcher_.wait()) reload();
+        });
+    }
+    ReloadableArgParserTpl(ReloadableArgParserTpl const &) = delete;
+    ReloadableArgParserTpl &operator=(ReloadableArgParserTpl const &) = delete;
+    /**@brief stops watching the file
+     *
+     * Snapshots that are still held by readers stay valid.
+     */
+    ~ReloadableArgParserTpl() {
+        watcher_.stop();
+        thread_.join();
+    }
+
+    //------------------- const fct -------------------
+    /**@brief returns the current snapshot
+     *
+     * Can be called from any thread. The snapshot does not change, call
+     * snapshot() again to see a later reload.
+     * Every thread caches the last snapshot it got and returns it as long
+     * as generation() did not change, which neither locks nor waits. The
+     * first call of a thread after a reload (or after it read another
+     * ReloadableArgParser) fetches the new snapshot with std::atomic_load,
+     * which takes a mutex of the standard library, i.e. it can wait for
+     * other such calls and for the publishing of a snapshot, but never for
+     * the parsing of the file. The cache keeps the snapshot alive until the
+     * thread calls snapshot() again or ends.
+     */
+    snapshot_type snapshot() const noexcept {
+        thread_local struct {
+            std::uint64_t owner = 0;  // the id_ of the parser it is from
+            std::uint64_t gen = 0;
+            snapshot_type snap;
+        } cache;
+        // published after current_, i.e. current_ is at least as new
+        auto const gen = generation_.load(std::memory_order_acquire);
+        if(cache.owner != id_ or cache.gen != gen) {
+            cache.snap = std::atomic_load(&current_);
+            cache.owner = id_;
+            cache.gen = gen;
+        }
+        return cache.snap;
+    }
+    /**@brief returns the number of published snapshots
+     *
+     * Increases by one for every successful reload.
+     */
+    std::uint64_t generation() const noexcept { return generation_; }
+    /**@brief returns the number of reloads that kept the previous snapshot
+     * since the file could not be read or was ill-formed
+     */
+    std::uint64_t failures() const noexcept { return failures_; }
+    /**@brief returns the name of the watched file
+     */
+    std::string const &filename() const noexcept { return filename_; }
+
+    //------------------- modifier -------------------
+    /**@brief parse the file now and publish it
+     *
+     * Also called by the background thread when the file changed. Returns
+     * false if the file cannot be read or is ill-formed (or any other
+     * std::exception is thrown, e.g. std::bad_alloc), in which case the
+     * previous snapshot stays published.
+     */
+    bool reload() {
+        std::lock_guard<std::mutex> lock(reload_mutex_);  // writers only
+        try {
+            parser_type ap(base_);
+            if(ap.parse_file_buffered(filename_, overwrite_)) {
+                publish_(ap);
+                return true;
+            }
+        } catch(std::exception const &) {  // must not end the watcher thread
+        }
+        ++failures_;
+        return false;
+    }
+
+private:
+    static std::uint64_t new_id_() noexcept {
+        static std::atomic<std::uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+    void publish_(parser_type const &ap) {
+        std::atomic_store(&current_, snapshot_type(std::make_shared<
+                                         FrozenArgParser const>(ap.freeze())));
+        ++generation_;
+    }
+
+    std::string const filename_;
+    parser_type const base_;
+    bool const overwrite_;
+    snapshot_type current_;
+    std::atomic<std::uint64_t> generation_{0};  // ++ after current_ is set
+    std::uint64_t const id_ = new_id_();  // the address may be reused
+    std::atomic<std::uint64_t> failures_{0};
+    std::mutex reload_mutex_;
+    detail::file_watcher watcher_;
+    std::thread thread_;
+};
+
+using ReloadableArgParser = ReloadableArgParserTpl<>;
+
+}  // end namespace fsc
+#endif  // FSC_RELOADABLE_ARGPARSER_HEADER
@@ -0,0 +1,123 @@
+/** ****************************************************************************
+ * \file    access_test.cpp
+ * \brief   instrumented parsers record which keys are read
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParserDiff.hpp>
+#include <fsc/ArgParserSweep.hpp>
+#include <fsc/LayeredArgParser.hpp>
+#include <fsc/ReloadableArgParser.hpp>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+template <typename SP>
+using instrumented_parser =
+    fsc::ArgParserTpl<fsc::poly_type, SP, fsc::instrumented>;
+
+template <typename P>
+void check_access() {
+    auto &stats = fsc::access_stats::global();
+    stats.reset();
+    P ap("--dt 0.5 --name foo --unused 3 --slow");
+    for(int i = 0; i < 10; ++i) CHECK(ap.get("dt", 0.1) == 0.5);
+    auto const dt = ap.handle("dt");
+    CHECK(double(ap[dt]) == 0.5);
+    CHECK(ap.get(dt, 0.1) == 0.5);
+    CHECK_THROWS(ap.get("name", 1));
+    CHECK(ap.is_set("slow"));
+    CHECK(!ap.is_set("seed"));
+    CHECK(ap.get("L", 4) == 4);
+
+    auto const keys = stats.keys();
+    CHECK(keys.at("dt").lookups == 12);
+    CHECK(keys.at("dt").misses == 0);
+    CHECK(keys.at("name").cast_failures == 1);
+    CHECK(keys.at("name").lookups == 1);
+    CHECK(keys.at("slow").lookups == 1);
+    CHECK(keys.at("seed").misses == 1);
+    CHECK(!keys.at("seed").set);
+    CHECK(keys.at("L").misses == 1);
+    CHECK(keys.at("unused").set);
+    CHECK(keys.at("unused").lookups == 0);
+
+    std::stringstream ss;
+    stats.report(ss);
+    auto const report = ss.str();
+    auto const unused = report.find("unused:\n");
+    REQUIRE(unused != std::string::npos);
+    CHECK(report.find("    unused\n", unused) != std::string::npos);
+    CHECK(report.find("    dt ") < report.find("    slow "));  // hot first
+    stats.reset();
+}
+}  // namespace
+
+TEST_CASE("lookups, misses and casts are recorded", "[access]") {
+    check_access<instrumented_parser<fsc::ordered_keys>>();
+    check_access<instrumented_parser<fsc::hashed_keys>>();
+}
+
+TEST_CASE("merged keys are recorded as set", "[access]") {
+    auto &stats = fsc::access_stats::global();
+    stats.reset();
+    instrumented_parser<fsc::ordered_keys> ap;
+    ap.merge(instrumented_parser<fsc::ordered_keys>("--x 1 --flag"));
+    ap.def("y", 2);
+    auto const keys = stats.keys();
+    CHECK(keys.at("x").set);
+    CHECK(keys.at("flag").set);
+    CHECK(keys.at("y").set);
+    stats.reset();
+}
+
+TEST_CASE("diff and the views of instrumented parsers", "[access]") {
+    using P = instrumented_parser<fsc::ordered_keys>;
+    static_assert(!noexcept(std::declval<P const &>().is_set("x")));
+    static_assert(noexcept(std::declval<fsc::ArgParser const &>().is_set("x")));
+    static_assert(std::is_same<fsc::ReloadableArgParserTpl<
+                                   fsc::poly_type, fsc::ordered_keys,
+                                   fsc::instrumented>::parser_type,
+                               P>::value);
+    auto &stats = fsc::access_stats::global();
+    P const a("--x 1 --f"), b("--x 2 --g");
+    stats.reset();
+    CHECK(fsc::diff(a, b).keys.size() == 3);
+    CHECK(stats.keys().empty());  // diff does not read the keys
+
+    // one lookup of the view, not one per layer
+    fsc::LayeredArgParserTpl<fsc::poly_type, fsc::ordered_keys,
+                             fsc::instrumented> const lp(a, b);
+    CHECK(lp.is_set("g"));
+    CHECK(lp.get("y", 3) == 3);
+    CHECK(int(lp["x"]) == 1);
+    auto const keys = stats.keys();
+    CHECK(keys.at("g").lookups == 1);
+    CHECK(keys.at("g").misses == 0);
+    CHECK(keys.at("y").misses == 1);
+    CHECK(keys.at("x").lookups == 1);
+
+    fsc::ArgParserSweepTpl<fsc::poly_type, fsc::ordered_keys,
+                           fsc::instrumented> const sweep(P("n=[1,2]"));
+    CHECK(int(sweep.at(1)["n"]) == 2);
+    CHECK(stats.keys().at("n").set);
+    stats.reset();
+}
+
+TEST_CASE("parsers without instrumentation record nothing", "[access]") {
+    auto &stats = fsc::access_stats::global();
+    stats.reset();
+    fsc::ArgParser ap("--x 1");
+    CHECK(int(ap["x"]) == 1);
+    CHECK(stats.keys().empty());
+    static_assert(sizeof(fsc::ArgParser) ==
+                      sizeof(instrumented_parser<fsc::ordered_keys>),
+                  "the instrumentation has no state in the parser");
+}
@@ -0,0 +1,120 @@
+/** ****************************************************************************
+ * \file    arena_test.cpp
+ * \brief   a parser that allocates from a memory resource
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <memory_resource>
+#include <sstream>
+
+namespace {
+/// forwards to `up` and counts the bytes that are still allocated
+class counting_resource : public std::pmr::memory_resource {
+public:
+    explicit counting_resource(std::pmr::memory_resource *up) : up_(up) {}
+    std::size_t calls = 0;
+    std::size_t bytes = 0;
+
+private:
+    void *do_allocate(std::size_t n, std::size_t a) override {
+        ++calls;
+        bytes += n;
+        return up_->allocate(n, a);
+    }
+    void do_deallocate(void *p, std::size_t n, std::size_t a) override {
+        bytes -= n;
+        up_->deallocate(p, n, a);
+    }
+    bool do_is_equal(
+        std::pmr::memory_resource const &rhs) const noexcept override {
+        return this == &rhs;
+    }
+    std::pmr::memory_resource *up_;
+};
+
+char const *cline = "free0 a=1 --c 3.25 --f1 -g s=\"a b\" n=-7 --path "
+                    "/a/long/path/that/does/not/fit/into/a/small/string";
+
+template <typename P>
+std::string print(P const &ap) {
+    std::stringstream ss;
+    ss << ap;
+    return ss.str();
+}
+
+template <typename P>
+void check_arena() {
+    P const ref(cline);
+    counting_resource res(std::pmr::new_delete_resource());
+    {
+        P ap(cline, &res);
+        CHECK(res.calls > 0);
+        CHECK(print(ap) == print(ref));
+        CHECK(double(ap["c"]) == 3.25);
+
+        // a copy does not use the resource
+        auto const calls = res.calls;
+        P copy(ap);
+        CHECK(res.calls == calls);
+        ap = P(&res);
+        CHECK(print(copy) == print(ref));
+
+        // a moved parser keeps it
+        P moved(std::move(copy));
+        P heap("x=2");
+        heap.merge(P(cline, &res));
+        CHECK(print(moved) == print(ref));
+        CHECK(int(heap["x"]) == 2);
+        CHECK(std::string(heap["path"]) ==
+              "/a/long/path/that/does/not/fit/into/a/small/string");
+    }
+    CHECK(res.bytes == 0);
+}
+
+TEST_CASE("a parser allocates from its memory resource", "[arena]") {
+    check_arena<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>();
+    check_arena<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>();
+    check_arena<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::ordered_keys>>();
+    check_arena<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+}
+
+template <typename P>
+void check_buffer() {
+    alignas(std::max_align_t) static char buffer[1 << 14];
+    // throws std::bad_alloc if the parser needs more than the buffer
+    std::pmr::monotonic_buffer_resource arena(
+        buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    P const ap(cline, &arena);
+    CHECK(print(ap) == print(P(cline)));
+    CHECK(int(ap["n"]) == -7);
+    CHECK(ap.is_set("f1"));
+}
+}  // namespace
+
+TEST_CASE("a lazy parser lives in a buffer", "[arena]") {
+    check_buffer<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::ordered_keys>>();
+    check_buffer<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+}
+
+TEST_CASE("reparse reuses the memory of the previous parse", "[arena]") {
+    using P = fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>;
+    counting_resource res(std::pmr::new_delete_resource());
+    P ap(&res);
+    ap.reparse(cline);
+    CHECK(print(ap) == print(P(cline)));
+    ap.reparse("-x 1 --y=2 free");
+    auto const calls = res.calls;
+    ap.reparse(cline);
+    ap.reparse("-x 1 --y=2 free");
+    CHECK(res.calls == calls);
+    CHECK(print(ap) == print(P("-x 1 --y=2 free")));
+
+    CHECK_THROWS_AS(ap.reparse("-a 'b"), fsc::cat_on_your_keyboard_error);
+    CHECK(print(ap) == print(P()));
+}
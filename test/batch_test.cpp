@@ -0,0 +1,111 @@
+/** ****************************************************************************
+ * \file    batch_test.cpp
+ * \brief   parallel parsing of files and buffers
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParserBatch.hpp>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+std::string print(fsc::ArgParser const &ap) {
+    std::stringstream ss;
+    ss << ap;
+    return ss.str();
+}
+}  // namespace
+
+TEST_CASE("every index is visited once", "[batch]") {
+    for(unsigned threads : {1u, 3u, 8u}) {
+        // Catch is not thread safe, only count in the workers
+        std::vector<std::atomic<int>> seen(1000);
+        for(auto &s : seen) s = 0;
+        std::atomic<int> bad_worker(0);
+        fsc::detail::parallel_for(
+            seen.size(), threads,
+            [&](unsigned w, std::size_t i) {
+                if(w >= threads) ++bad_worker;
+                ++seen[i];
+            },
+            1);
+        int wrong = 0;
+        for(auto const &s : seen) wrong += s != 1;
+        CHECK(wrong == 0);
+        CHECK(bad_worker == 0);
+    }
+    CHECK_THROWS_AS(fsc::detail::parallel_for(100, 4,
+                                              [](unsigned, std::size_t i) {
+                                                  if(i == 50)
+                                                      throw std::runtime_error(
+                                                          "50");
+                                              }),
+                    std::runtime_error);
+}
+
+TEST_CASE("a batch parses like parse_file", "[batch]") {
+    std::vector<std::string> names;
+    std::vector<std::string> contents;
+    for(int i = 0; i < 200; ++i) {
+        names.push_back("fsc_batch_test_" + std::to_string(i) + ".txt");
+        contents.push_back("free" + std::to_string(i) + " --mcs " +
+                           std::to_string(i * 100) + " T=0.5 --fast");
+        if(i == 7) contents.back() = "name=\"unterminated";
+        std::ofstream(names.back()) << contents.back();
+    }
+    names.push_back("fsc_batch_test_missing.txt");
+
+    for(unsigned threads : {1u, 4u}) {
+        auto const res = fsc::parse_files(names, threads);
+        REQUIRE(res.size() == names.size());
+        for(std::size_t i = 0; i < names.size(); ++i) {
+            fsc::ArgParser ap;
+            bool ok;
+            try {
+                ok = ap.parse_file(names[i]);
+            } catch(std::runtime_error const &) {
+                ok = false;
+            }
+            CHECK(bool(res[i]) == ok);
+            if(ok)
+                CHECK(print(*res[i].args) == print(ap));
+            else
+                CHECK(!res[i].error.empty());
+        }
+        CHECK(res.back().error.find("cannot read") != std::string::npos);
+
+        // with a pool per thread the parsers are the same
+        fsc::batch_pools const pools(threads);
+        CHECK(pools.threads() == threads);
+        auto const pooled = fsc::parse_files(names, pools);
+        REQUIRE(pooled.size() == res.size());
+        for(std::size_t i = 0; i < res.size(); ++i) {
+            CHECK(bool(pooled[i]) == bool(res[i]));
+            if(res[i]) CHECK(print(*pooled[i].args) == print(*res[i].args));
+        }
+    }
+
+    std::vector<std::string_view> views(contents.begin(), contents.end());
+    auto const res =
+        fsc::parse_buffers<fsc::ArgParserTpl<fsc::lazy_poly_type>>(views, 4);
+    REQUIRE(res.size() == views.size());
+    CHECK(!res[7]);
+    CHECK(int((*res[3].args)["mcs"]) == 300);
+    CHECK(std::string((*res[199].args)[0]) == "free199");
+    fsc::batch_pools const pools(3);
+    auto const pooled =
+        fsc::parse_buffers<fsc::ArgParserTpl<fsc::lazy_poly_type>>(views,
+                                                                  pools);
+    CHECK(!pooled[7]);
+    CHECK(int((*pooled[3].args)["mcs"]) == 300);
+    CHECK(std::string((*pooled[199].args)[0]) == "free199");
+
+    for(auto const &name : names) std::remove(name.c_str());
+}
@@ -0,0 +1,91 @@
+/** ****************************************************************************
+ * \file    diagnostics_test.cpp
+ * \brief   warnings go to the diagnostics of the parser
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+// one overwritten named argument and one flag that is set twice
+template <typename P>
+void warn(fsc::diagnostics &diag) {
+    P ap("a=1 -f");
+    ap.set_diagnostics(diag);
+    ap.merge(P("a=2 -f b=3"));
+}
+}  // namespace
+
+TEST_CASE("print mode writes one line per warning", "[diagnostics]") {
+    std::stringstream ss;
+    fsc::diagnostics diag(ss);
+    warn<fsc::ArgParser>(diag);
+    CHECK(ss.str() ==
+          "ArgParser warning: named argument 'a' is overwritten (1 -> 2)\n"
+          "ArgParser warning: setting flag 'f' for a second time has no "
+          "effect\n");
+    CHECK(diag.count(fsc::diag_event::overwrite) == 1);
+    CHECK(diag.count(fsc::diag_event::flag_twice) == 1);
+}
+
+TEST_CASE("silent and counters mode do not write", "[diagnostics]") {
+    fsc::diagnostics silent(fsc::diagnostics::silent);
+    warn<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>(silent);
+    CHECK(silent.count(fsc::diag_event::overwrite) == 0);
+    CHECK(silent.take() == "");
+
+    fsc::diagnostics counters(fsc::diagnostics::counters);
+    warn<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>(counters);
+    warn<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>(counters);
+    CHECK(counters.count(fsc::diag_event::overwrite) == 2);
+    CHECK(counters.count(fsc::diag_event::flag_twice) == 2);
+    CHECK(counters.take() == "");
+    counters.reset_counts();
+    CHECK(counters.count(fsc::diag_event::overwrite) == 0);
+}
+
+TEST_CASE("buffered mode collects the warnings", "[diagnostics]") {
+    fsc::diagnostics diag(fsc::diagnostics::buffered);
+    warn<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::ordered_keys>>(diag);
+    std::stringstream ss;
+    diag.flush(ss);
+    CHECK(ss.str() ==
+          "ArgParser warning: named argument 'a' is overwritten (1 -> 2)\n"
+          "ArgParser warning: setting flag 'f' for a second time has no "
+          "effect\n");
+    CHECK(diag.take() == "");
+}
+
+TEST_CASE("callback mode gets structured events", "[diagnostics]") {
+    std::vector<fsc::diag_event> events;
+    std::vector<std::string> keys;
+    fsc::diagnostics diag([&](fsc::diag_event const &ev) {
+        events.push_back(ev);
+        events.back().key = "";  // only valid during the call
+        keys.emplace_back(ev.key);
+    });
+    warn<fsc::ArgParser>(diag);
+    REQUIRE(events.size() == 2);
+    CHECK(keys == std::vector<std::string>{"a", "f"});
+    CHECK(events[0].kind == fsc::diag_event::overwrite);
+    CHECK(events[0].old_value == "1");
+    CHECK(events[0].new_value == "2");
+    CHECK(events[1].kind == fsc::diag_event::flag_twice);
+
+    // copies report to the same diagnostics
+    fsc::ArgParser ap;
+    ap.set_diagnostics(diag);
+    fsc::ArgParser copy(ap);
+    copy.set("x", 1);
+    copy.merge(fsc::ArgParser("x=2"));
+    CHECK(keys.back() == "x");
+    CHECK(&copy.get_diagnostics() == &diag);
+}
@@ -0,0 +1,121 @@
+/** ****************************************************************************
+ * \file    diff_test.cpp
+ * \brief   changes between two parsers and their subscribers
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParserDiff.hpp>
+#include <algorithm>
+
+namespace {
+// key:kind:flag, sorted since hashed_keys reports in insertion order
+std::vector<std::string> keys(fsc::change_set const &changes) {
+    std::vector<std::string> res;
+    for(auto const &c : changes.keys)
+        res.push_back(c.key + ":" + "arc"[c.kind] + (c.flag ? ":f" : ""));
+    std::sort(res.begin(), res.end());
+    return res;
+}
+template <typename P>
+void check_diff() {
+    P const lhs("free0 free1 a=1 b=2 c=x d=1 --f1 --f2 --g");
+    P const rhs("free0 free2 free3 a=1 b=3 c=y d=1.0 e=4 --f1 --f3 g=5");
+    auto const changes = fsc::diff(lhs, rhs);
+    CHECK(keys(changes) == std::vector<std::string>{"b:c", "c:c", "d:c",
+                                                    "e:a", "f2:r:f",
+                                                    "f3:a:f", "g:a", "g:r:f"});
+    CHECK(changes.free == std::vector<std::size_t>{1, 2});
+    CHECK(fsc::diff(lhs, lhs).empty());
+    CHECK(fsc::diff(rhs, P(rhs)).empty());
+
+    auto const back = fsc::diff(rhs, lhs);
+    CHECK(keys(back) == std::vector<std::string>{"b:c", "c:c", "d:c", "e:r",
+                                                 "f2:a:f", "f3:r:f", "g:a:f",
+                                                 "g:r"});
+}
+}  // namespace
+
+TEST_CASE("diff of two parsers", "[diff]") {
+    check_diff<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>();
+    check_diff<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>();
+    check_diff<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::ordered_keys>>();
+    check_diff<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+
+    // sorted without the sort in keys()
+    auto const changes =
+        fsc::diff(fsc::ArgParser("c=1 a=1 --b"), fsc::ArgParser("a=2 c=2"));
+    REQUIRE(changes.keys.size() == 3);
+    CHECK(changes.keys[0].key == "a");
+    CHECK(changes.keys[1].key == "c");
+    CHECK(changes.keys[2].key == "b");
+}
+
+TEST_CASE("subscribers of changed keys are called", "[diff]") {
+    fsc::ChangeNotifier notify;
+    std::vector<std::string> calls;
+    notify.subscribe("a", [&](fsc::key_change const &c) {
+        calls.push_back("a" + std::to_string(c.kind));
+    });
+    auto const id = notify.subscribe(
+        "b", [&](fsc::key_change const &) { calls.push_back("b"); });
+    notify.subscribe("f", [&](fsc::key_change const &c) {
+        calls.push_back(c.flag ? "flag f" : "f");
+    });
+    notify.subscribe_free([&](std::vector<std::size_t> const &pos) {
+        calls.push_back("free" + std::to_string(pos.size()));
+    });
+
+    fsc::ArgParser const v1("a=1 b=1 c=1");
+    fsc::ArgParser const v2("x a=2 b=1 c=2 --f");
+    auto const changes = notify(v1, v2);
+    CHECK(changes.keys.size() == 3);
+    CHECK(calls == std::vector<std::string>{"a2", "flag f", "free1"});
+
+    calls.clear();
+    notify(v2, v2);
+    CHECK(calls.empty());
+
+    CHECK(notify.unsubscribe(id));
+    CHECK(!notify.unsubscribe(id));
+    notify(v1, fsc::ArgParser("a=1 b=2 c=1"));
+    CHECK(calls.empty());
+}
+
+TEST_CASE("callbacks may change the subscribers", "[diff]") {
+    fsc::ChangeNotifier notify;
+    std::vector<std::string> calls;
+    fsc::ChangeNotifier::id_type self = 0, other = 0, free_id = 0;
+    self = notify.subscribe("a", [&](fsc::key_change const &) {
+        calls.push_back("self");
+        CHECK(notify.unsubscribe(self));
+        CHECK(notify.unsubscribe(other));
+        // many new subscribers of the same and of new keys
+        for(int i = 0; i < 100; ++i)
+            notify.subscribe(i % 2 ? "a" : "k" + std::to_string(i),
+                             [&](fsc::key_change const &) {
+                                 calls.push_back("new");
+                             });
+    });
+    other = notify.subscribe(
+        "a", [&](fsc::key_change const &) { calls.push_back("other"); });
+    free_id = notify.subscribe_free([&](std::vector<std::size_t> const &) {
+        calls.push_back("free");
+        CHECK(notify.unsubscribe(free_id));
+    });
+
+    fsc::ArgParser const v1("a=1"), v2("x a=2");
+    notify(v1, v2);
+    // the removed subscriber is not called, the new ones are not called yet
+    CHECK(calls == std::vector<std::string>{"self", "free"});
+    CHECK(!notify.unsubscribe(self));
+    CHECK(!notify.unsubscribe(free_id));
+
+    calls.clear();
+    notify(v1, v2);
+    CHECK(calls == std::vector<std::string>(50, "new"));
+}
@@ -0,0 +1,70 @@
+/** ****************************************************************************
+ * \file    frozen_test.cpp
+ * \brief   a FrozenArgParser reads like the ArgParser it was frozen from
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+
+namespace {
+template <typename P>
+void check_frozen() {
+    P const ap("free0 1.5 a=1 --c 3.25 --f1 -g e=five s=\"a b\" n=-7 --t true");
+    auto const fz = ap.freeze();
+    std::stringstream lhs, rhs;
+    lhs << ap;
+    rhs << fz;
+    CHECK(lhs.str() == rhs.str());
+
+    for(auto key : {"a", "c", "e", "s", "n", "t", "f1", "g", "h"})
+        CHECK(fz.is_set(key) == ap.is_set(key));
+    CHECK(fz.freeargc() == ap.freeargc());
+    CHECK(std::string(fz[0]) == "free0");
+    CHECK(fz.get(2, 7) == 7);
+    CHECK(fz.get("h", "none") == "none");
+    CHECK(fz.cwd() == ap.cwd());
+    CHECK_THROWS_AS(fz[2], std::runtime_error);
+    CHECK_THROWS_AS(fz["f1"], std::runtime_error);
+    CHECK_THROWS_AS(fz["h"], std::runtime_error);
+    CHECK_THROWS_AS(fz.pwd(), std::runtime_error);
+}
+}  // namespace
+
+TEST_CASE("a frozen parser prints like the parser", "[frozen]") {
+    check_frozen<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>();
+    check_frozen<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>();
+    check_frozen<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::ordered_keys>>();
+    check_frozen<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+    check_frozen<fsc::ArgParserTpl<std::string, fsc::ordered_keys>>();
+}
+
+TEST_CASE("frozen values cast like poly_type", "[frozen]") {
+    fsc::ArgParser ap("a=1 --c 3.25 e=five t=true");
+    auto const fz = ap.freeze();
+    ap.merge(fsc::ArgParser("a=2 --f"));  // the snapshot does not change
+
+    CHECK(int(fz["a"]) == 1);
+    CHECK(double(fz["a"]) == 1.0);
+    CHECK(double(fz["c"]) == 3.25);
+    CHECK(fz.get("c", 0) == 3);
+    CHECK(std::string(fz["e"]) == "five");
+    CHECK(std::string_view(fz["e"]) == "five");
+    CHECK(std::string(fz["t"]) == "true");
+    CHECK(fz["a"].type() == ap["a"].type());
+    CHECK(fz["c"].type() == ap["c"].type());
+    CHECK(fz["e"].type() == ap["e"].type());
+    CHECK(!fz.is_set("f"));
+    CHECK_THROWS_AS(std::string(fz["a"]), fsc::O__o);
+    CHECK_THROWS_AS(int(fz["e"]), fsc::O__o);
+    CHECK_THROWS_AS(std::string_view(fz["c"]), fsc::O__o);
+
+    auto const copy = fz;
+    CHECK(std::string(copy["e"]) == "five");
+    CHECK(fsc::FrozenArgParser().freeargc() == 0);
+}
@@ -0,0 +1,134 @@
+/** ****************************************************************************
+ * \file    handle_test.cpp
+ * \brief   interned key handles resolve to the same values as the keys
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+template <typename P>
+void check_handles() {
+    P ap("--dt 0.5 --slow name=foo");
+    auto const dt = ap.handle("dt");
+    auto const slow = ap.handle("slow");
+    auto const name = ap.handle("name");
+    auto const seed = ap.handle("seed");
+    CHECK(ap.handle("dt") == dt);
+    CHECK(dt != slow);
+    CHECK(ap.name(seed) == "seed");
+
+    CHECK(double(ap[dt]) == 0.5);
+    CHECK(ap.get(dt, 0.1) == 0.5);
+    CHECK(ap.get(name, "bar") == "foo");
+    CHECK(ap.get(seed, 7) == 7);
+    CHECK(ap.is_set(slow));
+    CHECK(!ap.is_set(seed));
+    CHECK_THROWS_AS(ap[seed], std::runtime_error);
+    CHECK_THROWS_AS(ap[slow], std::runtime_error);
+
+    // the handles survive def, set and merge
+    ap.def(seed, 42);
+    CHECK(ap.get(seed, 7) == 42);
+    ap.def(seed, 43);
+    CHECK(int(ap[seed]) == 42);
+    ap.set(dt, 0.25);
+    CHECK(double(ap["dt"]) == 0.25);
+    P other("--dt 2 -L 8 --fast");
+    auto const L = ap.handle("L");
+    auto const fast = ap.handle("fast");
+    CHECK(!ap.is_set(L));
+    fsc::diagnostics quiet(fsc::diagnostics::silent);
+    ap.set_diagnostics(quiet);
+    ap.merge(std::move(other));
+    CHECK(int(ap[dt]) == 2);
+    CHECK(int(ap[L]) == 8);
+    CHECK(ap.is_set(fast));
+
+    // and copies
+    P copy(ap);
+    CHECK(int(copy[L]) == 8);
+    copy.set(L, 16);
+    CHECK(int(copy[L]) == 16);
+    CHECK(int(ap[L]) == 8);
+    P moved(std::move(copy));
+    CHECK(int(moved[L]) == 16);
+    copy = ap;
+    CHECK(int(copy[L]) == 8);
+
+    ap.reparse("-L 4");
+    CHECK(int(ap[L]) == 4);
+    CHECK(!ap.is_set(dt));
+    ap.reset();
+    CHECK(!ap.is_set(L));
+}
+}  // namespace
+
+TEST_CASE("key handles with ordered_keys", "[handle]") {
+    check_handles<fsc::ArgParser>();
+}
+
+TEST_CASE("key handles with hashed_keys", "[handle]") {
+    check_handles<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>();
+}
+
+TEST_CASE("key handles with lazy values", "[handle]") {
+    check_handles<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+}
+
+TEST_CASE("a handle of another parser", "[handle]") {
+    fsc::ArgParser a("-x 1");
+    fsc::ArgParser const b("-x 1");
+    a.handle("y");
+    auto const y = a.handle("x");
+    CHECK_THROWS_AS(b.get(y, 0), std::runtime_error);
+
+    // copies share the handles of before the copy, not the ones after
+    fsc::ArgParser c(a), d("-z 2");
+    auto const z = a.handle("z");
+    auto const zc = c.handle("z");
+    auto const zd = d.handle("z");
+    CHECK(z.id() == zc.id());
+    CHECK(int(c[y]) == 1);
+    CHECK_THROWS_AS(c.get(z, 0), std::runtime_error);
+    CHECK_THROWS_AS(a.get(zc, 0), std::runtime_error);
+    CHECK(d.get(zd, 0) == 2);
+    // an assignment takes over the handles of the right hand side
+    d = c;
+    CHECK_THROWS_AS(d.get(zd, 0), std::runtime_error);
+    CHECK(int(d[y]) == 1);
+    CHECK(d.get(zc, 0) == 0);
+    CHECK_THROWS_AS(d.get(z, 0), std::runtime_error);
+    fsc::ArgParser e(std::move(d));
+    CHECK(e.get(zc, 0) == 0);
+    CHECK_THROWS_AS(d.get(zc, 0), std::runtime_error);
+}
+
+TEST_CASE("handles of a const parser from several threads", "[handle]") {
+    fsc::ArgParser ap("--dt 0.5 --slow");
+    auto const dt = ap.handle("dt");
+    auto const slow = ap.handle("slow");
+    auto const seed = ap.handle("seed");
+    fsc::ArgParser const &cap = ap;
+    // Catch is not thread safe, only count in the threads
+    std::atomic<int> wrong(0);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 8; ++t)
+        threads.emplace_back([&]() {
+            for(int i = 0; i < 1000; ++i)
+                wrong += cap.get(dt, 0.) != 0.5 or !cap.is_set(slow) or
+                         cap.get(seed, 3) != 3;
+        });
+    for(auto &t : threads) t.join();
+    CHECK(wrong == 0);
+}
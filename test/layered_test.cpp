@@ -0,0 +1,87 @@
+/** ****************************************************************************
+ * \file    layered_test.cpp
+ * \brief   a LayeredArgParser resolves keys like the merged layers
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/LayeredArgParser.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+template <typename V, typename S>
+void check_layered() {
+    using P = fsc::ArgParserTpl<V, S>;
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    P const cline("free0 a=1 --c 3 --f1 -g");
+    P const job("free1 free2 a=2 b=x --f2 d=4.5");
+    P const site("a=3 b=y e=6 --f3");
+    fsc::LayeredArgParserTpl<V, S> lp(cline, job, site);
+    auto const merged = lp.merged();
+
+    for(auto key : {"a", "b", "c", "d", "e", "f1", "f2", "f3", "g", "h"}) {
+        CHECK(lp.is_set(key) == merged.is_set(key));
+        if(merged.n_args().count(key)) {
+            std::stringstream l, m;
+            l << lp[key];
+            m << merged[key];
+            CHECK(l.str() == m.str());
+        } else
+            CHECK_THROWS_AS(lp[key], std::runtime_error);
+    }
+    CHECK(lp.freeargc() == 1);
+    CHECK(std::string(lp[0]) == "free0");
+    CHECK(lp.get(1, 7) == 7);
+    CHECK(int(lp["a"]) == 1);
+    CHECK(std::string(lp["b"]) == "x");
+    CHECK(double(lp["d"]) == 4.5);
+    CHECK_THROWS_AS(lp["f3"], std::runtime_error);
+    CHECK_THROWS_AS(lp[1], std::runtime_error);
+
+    P const reloaded("b=z --f4");
+    lp.set_layer(1, reloaded);
+    CHECK(std::string(lp["b"]) == "z");
+    CHECK(lp.is_set("f4"));
+    CHECK(!lp.is_set("f2"));
+    CHECK(!lp.is_set("d"));
+
+    P const conflict("--a");
+    lp.push_back(conflict);
+    CHECK(lp.layers() == 4);
+    CHECK_THROWS_AS(lp["a"], fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(lp.is_set("a"), fsc::cat_on_your_keyboard_error);
+    CHECK(int(lp["c"]) == 3);
+
+    fsc::LayeredArgParserTpl<V, S> empty;
+    CHECK(empty.layers() == 0);
+    CHECK(empty.freeargc() == 0);
+    CHECK(!empty.is_set("a"));
+    CHECK_THROWS_AS(empty["a"], std::runtime_error);
+    CHECK_THROWS_AS(empty.cwd(), std::runtime_error);
+    empty.push_back(site);
+    CHECK(int(empty["a"]) == 3);
+
+    // a temporary layer would not outlive the view
+    using L = fsc::LayeredArgParserTpl<V, S>;
+    static_assert(std::is_constructible<L, P const &, P &>::value, "");
+    static_assert(!std::is_constructible<L, P>::value, "");
+    static_assert(!std::is_constructible<L, P const &, P>::value, "");
+    static_assert(!std::is_constructible<L, P &&, P const &>::value, "");
+
+    std::cout.rdbuf(cout_buf);
+}
+}  // namespace
+
+TEST_CASE("a layered parser resolves like the merged layers", "[layered]") {
+    check_layered<fsc::poly_type, fsc::ordered_keys>();
+    check_layered<fsc::poly_type, fsc::hashed_keys>();
+    check_layered<fsc::lazy_poly_type, fsc::ordered_keys>();
+    check_layered<fsc::lazy_poly_type, fsc::hashed_keys>();
+}
@@ -0,0 +1,43 @@
+/** ****************************************************************************
+ * \file    lazy_test.cpp
+ * \brief   lazy_poly_type values are classified like eager ones
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <sstream>
+
+TEST_CASE("lazy values are classified like eager ones", "[lazy]") {
+    std::string const cline =
+        "free 7 -1.5 --a 42 --b=2147483648 -c 0x1p3 d=10abc -e 1e400 -f "
+        "--g '' -h inf";
+    fsc::ArgParser eager(cline);
+    fsc::ArgParserTpl<fsc::lazy_poly_type> lazy(cline);
+
+    std::stringstream se, sl;
+    se << eager;
+    sl << lazy;
+    CHECK(se.str() == sl.str());
+
+    for(auto const &it : eager.n_args())
+        CHECK(lazy[it.first].type() == it.second.type());
+    CHECK(lazy[1].type() == typeid(int));
+    CHECK(int(lazy["a"]) + 1 == 43);
+    CHECK(double(lazy["c"]) == 8.);
+    CHECK(lazy.get("zz", 3) == 3);
+    fsc::lazy_poly_type x = lazy["b"];
+    CHECK(x.type() == typeid(double));
+
+    // a copy does not refer to the tokens of the parser
+    fsc::lazy_poly_type y;
+    {
+        fsc::ArgParserTpl<fsc::lazy_poly_type> tmp("-y a_long_string_value");
+        y = tmp["y"];
+    }
+    CHECK(std::string(y) == "a_long_string_value");
+}
@@ -0,0 +1,139 @@
+/** ****************************************************************************
+ * \file    merge_test.cpp
+ * \brief   merge of a copied and of a moved ArgParser and of a file
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+template <typename P>
+std::string merged(bool const &move, bool const &overwrite) {
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    P lhs("free0 a=1 --c 3 --f1 -g e=5");
+    P rhs("free1 free2 a=2 b=x --f1 --f2 d=4.5 e=6");
+    if(move) {
+        lhs.merge(std::move(rhs), overwrite);
+        CHECK(rhs.n_args().size() == 0);
+        CHECK(rhs.freeargc() == 0);
+        CHECK(!rhs.is_set("f2"));
+    } else
+        lhs.merge(rhs, overwrite);
+
+    std::cout.rdbuf(cout_buf);
+    std::stringstream ss;
+    ss << sink.str() << lhs;
+    return ss.str();
+}
+template <typename P>
+void check_merge() {
+    for(bool overwrite : {true, false})
+        CHECK(merged<P>(true, overwrite) == merged<P>(false, overwrite));
+
+    P lhs("a=1 --f1");
+    lhs.merge(P("free a=2 b=x --f2"));
+    CHECK(int(lhs["a"]) == 2);
+    CHECK(std::string(lhs["b"]) == "x");
+    CHECK(lhs.is_set("f1"));
+    CHECK(lhs.is_set("f2"));
+    CHECK(std::string(lhs[0]) == "free");
+
+    P keep("a=1");
+    keep.merge(P("a=2 b=3 free"), false);
+    CHECK(int(keep["a"]) == 1);
+    CHECK(int(keep["b"]) == 3);
+    CHECK(keep.freeargc() == 0);
+
+    // a flag/named collision throws and changes neither parser
+    for(bool move : {true, false}) {
+        P clash("free0 a=1 --f1");
+        P flag("free1 b=2 --a"), named("free1 b=2 f1=3");
+        for(auto *rhs : {&flag, &named}) {
+            if(move)
+                CHECK_THROWS_AS(clash.merge(std::move(*rhs)),
+                                fsc::cat_on_your_keyboard_error);
+            else
+                CHECK_THROWS_AS(clash.merge(*rhs),
+                                fsc::cat_on_your_keyboard_error);
+            CHECK(rhs->is_set("b"));
+            CHECK(rhs->freeargc() == 1);
+        }
+        CHECK(int(clash["a"]) == 1);
+        CHECK(clash.is_set("f1"));
+        CHECK(!clash.is_set("b"));
+        CHECK(std::string(clash[0]) == "free0");
+    }
+}
+}  // namespace
+
+TEST_CASE("merging a moved parser is the same as merging a copy",
+          "[merge]") {
+    check_merge<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>();
+    check_merge<fsc::ArgParserTpl<fsc::poly_type, fsc::hashed_keys>>();
+    check_merge<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::ordered_keys>>();
+    check_merge<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+}
+
+TEST_CASE("parsing a file is the same as merging its parser", "[merge]") {
+    std::string const name = "merge_test_file.txt";
+    std::string const content = "free a=2 b=x --f2 -c 3 c=4";
+    std::ofstream(name) << content;
+    for(bool overwrite : {true, false}) {
+        fsc::ArgParser lhs("free0 a=1 --f1"), rhs("free0 a=1 --f1");
+        lhs.merge(fsc::ArgParser(content), overwrite);
+        CHECK(rhs.parse_file(name, overwrite));
+        std::stringstream sl, sr;
+        lhs.print(sl);
+        rhs.print(sr);
+        CHECK(sl.str() == sr.str());
+    }
+    // a big file is mapped
+    std::string big;
+    while(big.size() < fsc::detail::mapped_file::map_threshold)
+        big += "k" + std::to_string(big.size()) + "=1 ";
+    std::ofstream(name) << big;
+    fsc::ArgParser ap, buffered;
+    CHECK(ap.parse_file(name));
+    CHECK(buffered.parse_file_buffered(name));
+    CHECK(ap.n_args().size() == buffered.n_args().size());
+
+    // an ill-formed file does not change the parser
+    std::ofstream(name) << "a=3 --f3 free 'open";
+    fsc::ArgParser keep("free0 a=1 --f1");
+    CHECK_THROWS_AS(keep.parse_file(name), std::runtime_error);
+    CHECK_THROWS_AS(keep.parse_file_buffered(name), std::runtime_error);
+    CHECK(int(keep["a"]) == 1);
+    CHECK(!keep.is_set("f3"));
+    CHECK(std::string(keep[0]) == "free0");
+
+    // so does a file that uses a flag of the parser as a key
+    std::ofstream(name) << "a=3 free f1=2";
+    CHECK_THROWS_AS(keep.parse_file(name), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(keep.parse_file_buffered(name),
+                    fsc::cat_on_your_keyboard_error);
+    CHECK(int(keep["a"]) == 1);
+    CHECK(keep.is_set("f1"));
+    CHECK(std::string(keep[0]) == "free0");
+
+    // or a key that is a flag in the file as well, in either order
+    for(auto const &clash : {"x=1 free --x", "--x -y x=1"}) {
+        std::ofstream(name) << "a=3 " << clash;
+        CHECK_THROWS_AS(keep.parse_file(name),
+                        fsc::cat_on_your_keyboard_error);
+        CHECK(int(keep["a"]) == 1);
+        CHECK(!keep.is_set("x"));
+        CHECK(std::string(keep[0]) == "free0");
+    }
+    std::remove(name.c_str());
+    CHECK(!keep.parse_file(name));
+}
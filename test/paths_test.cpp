@@ -0,0 +1,111 @@
+/** ****************************************************************************
+ * \file    paths_test.cpp
+ * \brief   cwd, pwd and progname are looked up only when they are needed
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+
+#include <dlfcn.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// counts the calls to getcwd of the whole test executable
+namespace {
+std::size_t getcwd_calls = 0;
+}  // namespace
+extern "C" char *getcwd(char *buf, std::size_t size) noexcept {
+    using fn_type = char *(*)(char *, std::size_t);
+    static auto const next =
+        reinterpret_cast<fn_type>(dlsym(RTLD_NEXT, "getcwd"));
+    ++getcwd_calls;
+    return next(buf, size);
+}
+
+namespace {
+template <typename P>
+void check_lazy() {
+    auto const before = getcwd_calls;
+    P def;
+    P str("free0 a=1 --c 3.25 -f");
+    std::vector<std::string_view> const toks = {"-x", "1", "free"};
+    P it(toks.begin(), toks.end());
+    P copy(str);
+    str.merge(it);
+    str.reparse("-y 2");
+    CHECK(getcwd_calls == before);
+
+    auto const cwd = copy.cwd();
+    CHECK(getcwd_calls == before + 1);
+    CHECK(copy.cwd() == cwd);  // cached
+    CHECK(getcwd_calls == before + 1);
+    CHECK(P(copy).cwd() == cwd);  // the copy has it as well
+    CHECK(getcwd_calls == before + 1);
+    CHECK_THROWS_AS(copy.pwd(), std::runtime_error);
+}
+}  // namespace
+
+TEST_CASE("parsing does not call getcwd", "[paths]") {
+    check_lazy<fsc::ArgParserTpl<fsc::poly_type, fsc::ordered_keys>>();
+    check_lazy<fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>>();
+}
+
+TEST_CASE("pwd and progname come from argv", "[paths]") {
+    std::string prog = "./bin/prog";
+    std::string arg = "--x=1";
+    char *argv[] = {&prog[0], &arg[0]};
+    auto const before = getcwd_calls;
+    fsc::ArgParser ap(2, argv);
+    CHECK(ap.progname() == "prog");
+    CHECK(getcwd_calls == before);
+    CHECK(ap.pwd() == ap.cwd() + "/./bin");
+    CHECK(getcwd_calls == before + 1);
+}
+
+TEST_CASE("a parser without paths never calls getcwd", "[paths]") {
+    auto const before = getcwd_calls;
+    fsc::ArgParser ap("free0 a=1 -f", fsc::no_paths);
+    CHECK(int(ap["a"]) == 1);
+    CHECK_THROWS_AS(ap.cwd(), std::runtime_error);
+    CHECK_THROWS_AS(ap.pwd(), std::runtime_error);
+    CHECK_THROWS_AS(ap.progname(), std::runtime_error);
+    std::stringstream ss;
+    ss << ap;
+    auto const fz = ap.freeze();
+    CHECK_THROWS_AS(fz.cwd(), std::runtime_error);
+
+    fsc::ArgParser other("b=2");
+    ap.merge(other);
+    CHECK_THROWS_AS(ap.cwd(), std::runtime_error);
+    CHECK(getcwd_calls == before);
+
+    // and does not take away the cwd of another parser
+    other.merge(fsc::ArgParser("c=3", fsc::no_paths));
+    CHECK(!other.cwd().empty());
+}
+
+TEST_CASE("the first lookup may come from several threads", "[paths]") {
+    std::string prog = "./bin/prog";
+    char *argv[] = {&prog[0]};
+    fsc::ArgParser const ap(1, argv);
+    auto const before = getcwd_calls;
+    // Catch is not thread safe, only compare in the threads
+    std::vector<std::string> pwds(8);
+    std::vector<std::thread> threads;
+    for(auto &pwd : pwds)
+        threads.emplace_back([&ap, &pwd]() {
+            std::stringstream ss;
+            ss << ap;
+            pwd = ap.pwd();
+        });
+    for(auto &t : threads) t.join();
+    CHECK(getcwd_calls == before + 1);
+    for(auto const &pwd : pwds) CHECK(pwd == ap.cwd() + "/./bin");
+}
@@ -0,0 +1,29 @@
+/** ****************************************************************************
+ * \file    poly_type_test.cpp
+ * \brief   values that are stored into a poly_type
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+
+TEST_CASE("integers that do not fit into an int are rejected",
+          "[poly_type]") {
+    fsc::ArgParser ap;
+    ap.def("a", short(-7));
+    ap.def("b", 2147483647LL);
+    ap.def("c", std::size_t(42));
+    CHECK(int(ap["a"]) == -7);
+    CHECK(int(ap["b"]) == 2147483647);
+    CHECK(int(ap["c"]) == 42);
+    CHECK_THROWS_AS(ap.def("d", 10000000000LL), fsc::O__o);
+    CHECK_THROWS_AS(ap.def("e", -2147483649LL), fsc::O__o);
+    CHECK_THROWS_AS(ap.set("c", std::size_t(1) << 31), fsc::O__o);
+    CHECK_THROWS_AS(fsc::poly_type(2147483648u), fsc::O__o);
+    CHECK_FALSE(ap.is_set("d"));
+    CHECK(int(ap["c"]) == 42);
+}
@@ -0,0 +1,147 @@
+/** ****************************************************************************
+ * \file    reloadable_test.cpp
+ * \brief   a ReloadableArgParser publishes a new snapshot when the file
+ *          changes
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ReloadableArgParser.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+void write(std::string const &filename, std::string const &content) {
+    // replaced by a rename, like most editors do
+    std::ofstream(filename + ".tmp") << content;
+    std::rename((filename + ".tmp").c_str(), filename.c_str());
+}
+// waits up to 10s for the generation to pass `gen`
+template <typename R>
+bool wait_for(R const &cfg, std::uint64_t const &gen) {
+    for(int i = 0; i < 1000 and cfg.generation() <= gen; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return cfg.generation() > gen;
+}
+}  // namespace
+
+TEST_CASE("a reloadable parser follows its file", "[reload]") {
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    std::string const filename =
+        "fsc_reload_test_" + std::to_string(::getpid()) + ".txt";
+    write(filename, "n=1 --fast name=a");
+    using std::chrono::milliseconds;
+
+    for(bool overwrite : {true, false}) {
+        write(filename, "n=1 --fast name=a");
+        fsc::ReloadableArgParser cfg(filename, fsc::ArgParser("n=0 m=5"),
+                                     overwrite, milliseconds(10));
+        auto const first = cfg.snapshot();
+        CHECK(cfg.generation() == 1);
+        CHECK(int(first->operator[]("n")) == (overwrite ? 1 : 0));
+        CHECK(int(first->operator[]("m")) == 5);
+        CHECK(first->is_set("fast"));
+
+        auto const gen = cfg.generation();
+        write(filename, "n=2 name=b");
+        REQUIRE(wait_for(cfg, gen));
+        auto const second = cfg.snapshot();
+        CHECK(int(second->operator[]("n")) == (overwrite ? 2 : 0));
+        CHECK(std::string(second->operator[]("name")) == "b");
+        CHECK(!second->is_set("fast"));
+        // the old snapshot is not touched
+        CHECK(std::string(first->operator[]("name")) == "a");
+
+        // an ill-formed file keeps the last snapshot
+        auto const failures = cfg.failures();
+        write(filename, "name=\"c");
+        for(int i = 0; i < 1000 and cfg.failures() == failures; ++i)
+            std::this_thread::sleep_for(milliseconds(10));
+        CHECK(cfg.failures() > failures);
+        CHECK(std::string(cfg.snapshot()->operator[]("name")) == "b");
+    }
+    std::remove(filename.c_str());
+    std::cout.rdbuf(cout_buf);
+}
+
+TEST_CASE("a file that is rewritten in place is reloaded", "[reload]") {
+    std::stringstream sink;
+    auto *const cout_buf = std::cout.rdbuf(sink.rdbuf());
+
+    std::string const filename =
+        "fsc_reload_inplace_" + std::to_string(::getpid()) + ".txt";
+    std::ofstream(filename) << "n=1";
+    fsc::ReloadableArgParser cfg(filename, fsc::ArgParser(), true,
+                                 std::chrono::milliseconds(10));
+    CHECK(int(cfg.snapshot()->operator[]("n")) == 1);
+    for(int n = 2; n < 5; ++n) {
+        auto const gen = cfg.generation();
+        std::ofstream(filename) << "n=" << n;  // truncated, like `echo >`
+        REQUIRE(wait_for(cfg, gen));
+        for(int i = 0; i < 1000 and cfg.snapshot()->get("n", 0) != n; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        CHECK(cfg.snapshot()->get("n", 0) == n);
+    }
+    std::remove(filename.c_str());
+    std::cout.rdbuf(cout_buf);
+}
+
+TEST_CASE("a file that clashes with a flag of the base is not published",
+          "[reload]") {
+    std::string const filename =
+        "fsc_reload_clash_" + std::to_string(::getpid()) + ".txt";
+    write(filename, "slow=1 n=1");
+    fsc::ReloadableArgParser cfg(filename, fsc::ArgParser("--slow n=0"), true,
+                                 std::chrono::milliseconds(10));
+    CHECK(cfg.failures() == 1);  // the base is published instead
+    CHECK(cfg.snapshot()->is_set("slow"));
+    CHECK(int(cfg.snapshot()->operator[]("n")) == 0);
+
+    auto const gen = cfg.generation();
+    write(filename, "n=2");
+    REQUIRE(wait_for(cfg, gen));
+    auto const good = cfg.snapshot();
+    CHECK(int(good->operator[]("n")) == 2);
+
+    auto const failures = cfg.failures();
+    write(filename, "slow=1 n=3");
+    for(int i = 0; i < 1000 and cfg.failures() == failures; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK(cfg.failures() > failures);
+    CHECK(cfg.snapshot() == good);
+    CHECK(int(cfg.snapshot()->operator[]("n")) == 2);
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("snapshots of two reloadable parsers in one thread", "[reload]") {
+    std::string const name =
+        "fsc_reload_two_" + std::to_string(::getpid()) + "_";
+    write(name + "a.txt", "n=1");
+    write(name + "b.txt", "n=2");
+    using std::chrono::milliseconds;
+    for(int round = 0; round < 2; ++round) {
+        // the second round may get the addresses of the first one
+        fsc::ReloadableArgParser a(name + "a.txt", fsc::ArgParser(), true,
+                                   milliseconds(10));
+        fsc::ReloadableArgParser b(name + "b.txt", fsc::ArgParser(), true,
+                                   milliseconds(10));
+        for(int i = 0; i < 3; ++i) {
+            CHECK(a.snapshot()->get("n", 0) == 1 + 2 * round);
+            CHECK(b.snapshot()->get("n", 0) == 2 + 2 * round);
+        }
+        write(name + "a.txt", "n=3");
+        write(name + "b.txt", "n=4");
+        for(int i = 0; i < 1000 and a.snapshot()->get("n", 0) != 3; ++i)
+            std::this_thread::sleep_for(milliseconds(10));
+        CHECK(a.snapshot()->get("n", 0) == 3);
+    }
+    std::remove((name + "a.txt").c_str());
+    std::remove((name + "b.txt").c_str());
+}
@@ -0,0 +1,114 @@
+/** ****************************************************************************
+ * \file    schema_test.cpp
+ * \brief   keys of a Schema are parsed into typed slots
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgSchema.hpp>
+#include <string>
+
+TEST_CASE("keys of the schema go to their slots", "[schema]") {
+    fsc::Schema schema;
+    auto const mcs = schema.add<int>("mcs");
+    auto const temp = schema.add<double>("T");
+    auto const out = schema.add<std::string>("out");
+    auto const slow = schema.add<bool>("slow");
+    auto const fast = schema.add<bool>("fast");
+    CHECK(schema.size() == 5);
+    CHECK(schema.contains("T"));
+    CHECK(!schema.contains("t"));
+    CHECK(schema.name(out.slot) == "out");
+
+    fsc::SchemaArgParser const ap(schema,
+                                  "free0 --mcs 100 T=1 --slow -x 3 out=42");
+    CHECK(ap.slot(mcs) == 100);
+    CHECK(ap.slot<double>(temp) == 1.0);  // an int token as double
+    CHECK(ap.slot(out) == "42");
+    CHECK(ap.slot(slow));
+    CHECK(!ap.slot(fast));
+    CHECK(!ap.is_set(fast));
+
+    // everything else is dynamic
+    CHECK(int(ap.dynamic()["x"]) == 3);
+    CHECK(std::string(ap.dynamic()[0]) == "free0");
+    CHECK(!ap.dynamic().is_set("mcs"));
+    CHECK(!ap.dynamic().is_set("slow"));
+}
+
+TEST_CASE("a flag of the schema is followed by a free argument",
+          "[schema]") {
+    fsc::Schema schema;
+    auto const slow = schema.add<bool>("slow");
+    fsc::SchemaArgParser const ap(schema, "--slow input.txt --other x");
+    CHECK(ap.slot(slow));
+    REQUIRE(ap.dynamic().freeargc() == 1);
+    CHECK(std::string(ap.dynamic()[0]) == "input.txt");
+    CHECK(std::string(ap.dynamic()["other"]) == "x");
+}
+
+TEST_CASE("slot ids by name", "[schema]") {
+    fsc::Schema schema;
+    auto const mcs = schema.add<int>("mcs");
+    schema.add<double>("T");
+    CHECK(schema.id<int>("mcs").slot == mcs.slot);
+    CHECK(schema.id<double>("T").index == 0);
+    CHECK_THROWS_AS(schema.id<double>("mcs"), std::runtime_error);
+    CHECK_THROWS_AS(schema.id<int>("L"), std::runtime_error);
+    CHECK_THROWS_AS(schema.add<int>("mcs"), fsc::cat_on_your_keyboard_error);
+}
+
+TEST_CASE("slots that are not set", "[schema]") {
+    fsc::Schema schema;
+    auto const mcs = schema.add<int>("mcs");
+    auto const out = schema.add<std::string>("out");
+    fsc::SchemaArgParser ap(schema, "--other");
+    CHECK_THROWS_AS(ap.slot(mcs), std::runtime_error);
+    CHECK(ap.slot(mcs, 7) == 7);
+    CHECK(ap.slot(out, std::string("none")) == "none");
+    ap.set(mcs, 9);
+    CHECK(ap.slot(mcs) == 9);
+}
+
+TEST_CASE("ill-formed keys of the schema throw", "[schema]") {
+    fsc::Schema schema;
+    schema.add<int>("mcs");
+    schema.add<bool>("slow");
+    using P = fsc::SchemaArgParser;
+    CHECK_THROWS_AS(P(schema, "--mcs many"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(P(schema, "slow=1"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(P(schema, "free --mcs"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(P(schema, "mcs=1.5"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(P(schema, "mcs=3000000000"),
+                    fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(P(schema, "mcs=1e20"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(P(schema, "mcs=nan"), fsc::cat_on_your_keyboard_error);
+    CHECK(P(schema, "mcs=2e3").slot(schema.id<int>("mcs")) == 2000);
+}
+
+TEST_CASE("slots that are not in the parser", "[schema]") {
+    fsc::Schema schema;
+    auto const mcs = schema.add<int>("mcs");
+    fsc::SchemaArgParser ap(schema, "mcs=1");
+    auto const late = schema.add<int>("late");  // after ap
+    CHECK(!ap.is_set(late));
+    CHECK(ap.slot(late, 3) == 3);
+    CHECK_THROWS_AS(ap.slot(late), std::out_of_range);
+    CHECK_THROWS_AS(ap.set(late, 1), std::out_of_range);
+    CHECK(ap.slot(mcs) == 1);
+
+    // an id of another schema is rejected, also if its slot is in range
+    fsc::Schema other;
+    auto const foreign = other.add<int>("foreign");
+    CHECK(foreign.slot == mcs.slot);
+    CHECK(foreign.index == mcs.index);
+    CHECK(!ap.is_set(foreign));
+    CHECK(ap.slot(foreign, 3) == 3);
+    CHECK_THROWS_AS(ap.slot(foreign), std::out_of_range);
+    CHECK_THROWS_AS(ap.set(foreign, 2), std::out_of_range);
+    CHECK(ap.slot(mcs) == 1);
+}
@@ -0,0 +1,134 @@
+/** ****************************************************************************
+ * \file    spec_test.cpp
+ * \brief   keys of an ArgSpec are parsed into slots, the rest is dynamic
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgSpec.hpp>
+#include <limits>
+#include <string>
+
+namespace {
+struct mcs : fsc::key<int> {
+    static constexpr std::string_view name = "mcs";
+};
+struct temp : fsc::key<double> {
+    static constexpr std::string_view name = "T";
+};
+struct out : fsc::key<std::string> {
+    static constexpr std::string_view name = "out";
+};
+struct slow : fsc::flag {
+    static constexpr std::string_view name = "slow";
+};
+using spec_type = fsc::ArgSpec<mcs, temp, out, slow>;
+struct count : fsc::key<unsigned> {
+    static constexpr std::string_view name = "count";
+};
+struct small : fsc::key<float> {
+    static constexpr std::string_view name = "small";
+};
+using other_type = fsc::ArgSpec<count, small>;
+struct seed : fsc::key<long long> {
+    static constexpr std::string_view name = "seed";
+};
+struct hash : fsc::key<unsigned long long> {
+    static constexpr std::string_view name = "hash";
+};
+using wide_type = fsc::ArgSpec<seed, hash>;
+}  // namespace
+
+TEST_CASE("keys of the spec go to their slots", "[spec]") {
+    spec_type const spec("free0 --mcs 100 T=0.5 --slow -x 3 out=42");
+    CHECK(spec.get<mcs>() == 100);
+    CHECK(spec.get<temp>() == 0.5);
+    CHECK(spec.get<out>() == "42");  // a string, also if it is a number
+    CHECK(spec.get<slow>());
+    CHECK(spec.is_set<mcs>());
+
+    // everything else is dynamic
+    auto const &dyn = spec.dynamic();
+    CHECK(int(dyn["x"]) == 3);
+    CHECK(std::string(dyn[0]) == "free0");
+    CHECK(!dyn.is_set("mcs"));
+    CHECK(!dyn.is_set("slow"));
+}
+
+TEST_CASE("a flag of the spec is followed by a free argument", "[spec]") {
+    spec_type const spec("--slow input.txt -slow out.txt --other x");
+    CHECK(spec.get<slow>());
+    auto const &dyn = spec.dynamic();
+    REQUIRE(dyn.freeargc() == 2);
+    CHECK(std::string(dyn[0]) == "input.txt");
+    CHECK(std::string(dyn[1]) == "out.txt");
+    CHECK(std::string(dyn["other"]) == "x");  // not in the spec
+}
+
+TEST_CASE("keys that are not set", "[spec]") {
+    spec_type spec("--other");
+    CHECK(!spec.is_set<mcs>());
+    CHECK(!spec.get<slow>());
+    CHECK(spec.get<mcs>(7) == 7);
+    CHECK_THROWS_AS(spec.get<mcs>(), std::runtime_error);
+    spec.set<mcs>(9);
+    CHECK(spec.get<mcs>() == 9);
+    CHECK(spec.dynamic().is_set("other"));
+}
+
+TEST_CASE("the perfect hash finds exactly the keys", "[spec]") {
+    static_assert(spec_type::size() == 4);
+    static_assert(spec_type::index_of("mcs") == 0);
+    static_assert(spec_type::index_of("T") == 1);
+    static_assert(spec_type::index_of("slow") == 3);
+    static_assert(spec_type::index_of("t") == -1);
+    static_assert(spec_type::index_of("") == -1);
+    static_assert(fsc::ArgSpec<>::index_of("mcs") == -1);
+    for(auto key : {"mc", "mcss", "Slow", "out ", "x", "other"})
+        CHECK(spec_type::index_of(key) == -1);
+}
+
+TEST_CASE("ill-formed keys of the spec throw", "[spec]") {
+    CHECK_THROWS_AS(spec_type("--mcs many"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(spec_type("slow=1"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(spec_type("free --mcs"), fsc::cat_on_your_keyboard_error);
+    for(auto const *cline : {"mcs=1.5", "mcs=3000000000", "mcs=1e20",
+                             "mcs=-inf"})
+        CHECK_THROWS_AS(spec_type(cline), fsc::cat_on_your_keyboard_error);
+    CHECK(spec_type("mcs=-2e3").get<mcs>() == -2000);
+
+    CHECK_THROWS_AS(other_type("count=-1"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(other_type("small=1e300"),
+                    fsc::cat_on_your_keyboard_error);
+    other_type const ok("count=4294967295 small=0.5");
+    CHECK(ok.get<count>() == 4294967295u);
+    CHECK(ok.get<small>() == 0.5f);
+}
+
+TEST_CASE("64 bit keys are exact beyond 2^53", "[spec]") {
+    wide_type const spec("seed=9007199254740993 hash=18446744073709551615");
+    CHECK(spec.get<seed>() == 9007199254740993LL);
+    CHECK(spec.get<hash>() == 18446744073709551615ULL);
+    CHECK(wide_type("seed=-9223372036854775808").get<seed>() ==
+          std::numeric_limits<long long>::min());
+    CHECK(wide_type("seed=+7 hash=1e3").get<hash>() == 1000);
+    for(auto const *cline : {"seed=9223372036854775808", "hash=-1",
+                             "hash=18446744073709551616", "seed=+-5"})
+        CHECK_THROWS_AS(wide_type(cline), fsc::cat_on_your_keyboard_error);
+}
+
+TEST_CASE("overwrites of the spec are reported", "[spec]") {
+    auto &diag = fsc::diagnostics::global();
+    diag.mode(fsc::diagnostics::counters);
+    auto const overwrites = diag.count(fsc::diag_event::overwrite);
+    auto const flags = diag.count(fsc::diag_event::flag_twice);
+    spec_type const spec("mcs=1 mcs=2 --slow --slow");
+    diag.mode(fsc::diagnostics::print);
+    CHECK(spec.get<mcs>() == 2);
+    CHECK(diag.count(fsc::diag_event::overwrite) == overwrites + 1);
+    CHECK(diag.count(fsc::diag_event::flag_twice) == flags + 1);
+}
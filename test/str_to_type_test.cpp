@@ -0,0 +1,82 @@
+/** ****************************************************************************
+ * \file    str_to_type_test.cpp
+ * \brief   Pins the int/double/string decision for parsed arguments
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <cmath>
+#include <fsc/ArgParser.hpp>
+
+namespace {
+fsc::poly_type parsed(std::string const &tok) {
+    fsc::ArgParser ap("x=" + tok);
+    return ap["x"];
+}
+bool is_int(std::string const &tok) {
+    return parsed(tok).type() == typeid(int);
+}
+bool is_double(std::string const &tok) {
+    return parsed(tok).type() == typeid(double);
+}
+bool is_string(std::string const &tok) {
+    return parsed(tok).type() == typeid(std::string);
+}
+}  // namespace
+
+TEST_CASE("whole integers are int", "[str_to_type]") {
+    CHECK(is_int("0"));
+    CHECK(is_int("42"));
+    CHECK(is_int("-7"));
+    CHECK(is_int("+5"));
+    CHECK(is_int("007"));
+    CHECK(is_int("2147483647"));
+    CHECK(is_int("-2147483648"));
+    CHECK(int(parsed("-2147483648")) == -2147483648);
+    CHECK(int(parsed("+5")) == 5);
+}
+
+TEST_CASE("integers beyond int are double", "[str_to_type]") {
+    CHECK(is_double("2147483648"));
+    CHECK(is_double("-2147483649"));
+    CHECK(double(parsed("3000000000")) == 3e9);
+}
+
+TEST_CASE("whole doubles are double", "[str_to_type]") {
+    CHECK(is_double("1.5"));
+    CHECK(is_double("-0.25"));
+    CHECK(is_double("+.5"));
+    CHECK(is_double("1."));
+    CHECK(is_double("1e3"));
+    CHECK(is_double("1E+3"));
+    CHECK(is_double("-2.5e-3"));
+    CHECK(is_double("0x1p3"));
+    CHECK(is_double("-0x10"));
+    CHECK(is_double("inf"));
+    CHECK(is_double("-Infinity"));
+    CHECK(is_double("nan"));
+    CHECK(double(parsed("0x1p3")) == 8.);
+    CHECK(double(parsed("-0x10")) == -16.);
+    CHECK(std::isinf(double(parsed("-Infinity"))));
+}
+
+TEST_CASE("everything else is a string", "[str_to_type]") {
+    CHECK(is_string(""));
+    CHECK(is_string("abc"));
+    CHECK(is_string("10abc"));
+    CHECK(is_string("1.5.2"));
+    CHECK(is_string("1e"));
+    CHECK(is_string("."));
+    CHECK(is_string("-"));
+    CHECK(is_string("+-5"));
+    CHECK(is_string("--5"));
+    CHECK(is_string("0x"));
+    CHECK(is_string("0x-1"));
+    CHECK(is_string("1e400"));
+    CHECK(is_string("1,5"));
+    CHECK(std::string(parsed("10abc")) == "10abc");
+}
@@ -0,0 +1,128 @@
+/** ****************************************************************************
+ * \file    sweep_test.cpp
+ * \brief   ranges and lists of values and the combinations of a sweep
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParserSweep.hpp>
+
+TEST_CASE("sweep over ranges and lists", "[sweep]") {
+    fsc::ArgParserSweep const sweep(fsc::ArgParser(
+        "free --mcs [1000:100000:1000] T=[0.5,1.0,2.0] L=[8:10] "
+        "x=[0:1:0.25] name=[a,b] host=localhost:80 --fast"));
+    REQUIRE(sweep.dims().size() == 5);
+    CHECK(sweep.size() == 100 * 3 * 3 * 5 * 2);
+
+    // sorted keys, the last one varies fastest
+    auto const &d = sweep.dims();
+    CHECK(d[0].key == "L");
+    CHECK(d[0].size == 3);
+    CHECK(d[1].key == "T");
+    CHECK(d[1].kind == fsc::ArgParserSweep::dimension::list);
+    CHECK(d[2].key == "mcs");
+    CHECK(d[2].size == 100);
+    CHECK(d[3].key == "name");
+    CHECK(d[4].key == "x");
+    CHECK(d[4].size == 5);
+
+    auto const first = sweep.at(0);
+    CHECK(int(first["L"]) == 8);
+    CHECK(first["T"].type() == typeid(double));
+    CHECK(double(first["T"]) == 0.5);
+    CHECK(int(first["mcs"]) == 1000);
+    CHECK(std::string(first["name"]) == "a");
+    CHECK(double(first["x"]) == 0.0);
+    CHECK(std::string(first["host"]) == "localhost:80");
+    CHECK(first.is_set("fast"));
+    CHECK(std::string(first[0]) == "free");
+
+    auto const last = sweep.at(sweep.size() - 1);
+    CHECK(int(last["L"]) == 10);
+    CHECK(double(last["T"]) == 2.0);
+    CHECK(int(last["mcs"]) == 100000);
+    CHECK(std::string(last["name"]) == "b");
+    CHECK(double(last["x"]) == 1.0);
+
+    // k = ((((L * 3 + T) * 100 + mcs) * 2 + name) * 5 + x
+    std::size_t const k = (((1 * 3 + 2) * 100 + 41) * 2 + 1) * 5 + 3;
+    auto const mid = sweep[k];
+    CHECK(int(mid["L"]) == 9);
+    CHECK(double(mid["T"]) == 2.0);
+    CHECK(int(mid["mcs"]) == 42000);
+    CHECK(std::string(mid["name"]) == "b");
+    CHECK(double(mid["x"]) == 0.75);
+    CHECK_THROWS_AS(sweep.at(sweep.size()), std::out_of_range);
+
+    std::size_t n = 0;
+    fsc::ArgParserSweep const small(fsc::ArgParser("a=[1,2] b=x"));
+    for(auto it = small.begin(); it != small.end(); ++it, ++n) {
+        CHECK(it.index() == n);
+        CHECK(int((*it)["a"]) == int(n) + 1);
+        CHECK(std::string((*it)["b"]) == "x");
+    }
+    CHECK(n == 2);
+    CHECK(fsc::ArgParserSweep(fsc::ArgParser("a=1")).size() == 1);
+    CHECK_THROWS_AS(fsc::ArgParserSweep(fsc::ArgParser("a=[10:1]")),
+                    fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(fsc::ArgParserSweep(fsc::ArgParser("a=[1:2:0]")),
+                    fsc::cat_on_your_keyboard_error);
+    for(auto const *range : {"a=[0:inf]", "a=[-inf:0]", "a=[0:1e300:1e-300]",
+                             "a=[0:1:nan]", "a=[nan:1]"})
+        CHECK_THROWS_AS(fsc::ArgParserSweep(fsc::ArgParser(range)),
+                        fsc::cat_on_your_keyboard_error);
+    // j * step does not fit into an int, the values do
+    fsc::ArgParserSweep const wide(
+        fsc::ArgParser("a=[-2000000000:2000000000:1000000000]"));
+    CHECK(wide.size() == 5);
+    CHECK(int(wide.at(4)["a"]) == 2000000000);
+    fsc::ArgParserSweep const many(
+        fsc::ArgParser("a=[-2147483648:2147483647]"));
+    CHECK(many.size() == 4294967296u);
+    CHECK(int(many.at(many.size() - 1)["a"]) == 2147483647);
+
+    fsc::ArgParserSweepTpl<fsc::lazy_poly_type, fsc::hashed_keys> const lazy(
+        fsc::ArgParserTpl<fsc::lazy_poly_type, fsc::hashed_keys>(
+            "b=[1:3] a=[x,y]"));
+    CHECK(lazy.size() == 6);
+    CHECK(lazy.dims()[0].key == "b");
+    CHECK(int(lazy.at(5)["b"]) == 3);
+    CHECK(std::string(lazy.at(5)["a"]) == "y");
+
+    fsc::ArgParserSweepTpl<std::string> const str(
+        fsc::ArgParserTpl<std::string>("a=[1:3] b=[0.5,x]"));
+    CHECK(str.size() == 6);
+    CHECK(str.at(5)["a"] == "3");
+    CHECK(str.at(5)["b"] == "x");
+}
+
+TEST_CASE("only values in brackets are swept", "[sweep]") {
+    fsc::ArgParserSweep const none(
+        fsc::ArgParser("host=a,b out=x,y.txt t=10:30 r=1:2:3 l=[x u=x]"));
+    CHECK(none.dims().empty());
+    CHECK(none.size() == 1);
+    auto const ap = none.at(0);
+    CHECK(std::string(ap["host"]) == "a,b");
+    CHECK(std::string(ap["out"]) == "x,y.txt");
+    CHECK(std::string(ap["t"]) == "10:30");
+    CHECK(std::string(ap["r"]) == "1:2:3");
+    CHECK(std::string(ap["l"]) == "[x");
+    CHECK(std::string(ap["u"]) == "x]");
+
+    // a list item can contain a ':', a single value is a list
+    fsc::ArgParserSweep const times(fsc::ArgParser("t=[10:30,11:00] n=[4]"));
+    REQUIRE(times.dims().size() == 2);
+    CHECK(times.dims()[0].key == "n");
+    CHECK(times.dims()[0].kind == fsc::ArgParserSweep::dimension::list);
+    CHECK(times.size() == 2);
+    CHECK(int(times.at(1)["n"]) == 4);
+    CHECK(std::string(times.at(1)["t"]) == "11:00");
+
+    for(auto const *invalid : {"a=[]", "a=[1:x]", "a=[x:1]", "a=[1:2:y]"})
+        CHECK_THROWS_AS(fsc::ArgParserSweep(fsc::ArgParser(invalid)),
+                        fsc::cat_on_your_keyboard_error);
+}
@@ -0,0 +1,102 @@
+/** ****************************************************************************
+ * \file    tokenizer_test.cpp
+ * \brief   Pins how a command line string is split into tokens
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ *    2026   | agent
+ * \copyright  see LICENSE
+ ******************************************************************************/
+
+#include <catch.hpp>
+#include <fsc/ArgParser.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+template <fsc::detail::simd S>
+std::vector<std::string> split(std::string const &str) {
+    fsc::detail::basic_tokenizer<S> tok(str);
+    return std::vector<std::string>(tok.begin(), tok.end());
+}
+// all implementations have to agree
+std::vector<std::string> tokens(std::string const &str) {
+    auto const res = split<fsc::detail::simd::scalar>(str);
+    CHECK(split<fsc::detail::best_simd>(str) == res);
+#if defined(__AVX2__)
+    CHECK(split<fsc::detail::simd::sse2>(str) == res);
+#endif
+    return res;
+}
+using vec = std::vector<std::string>;
+}  // namespace
+
+TEST_CASE("white-space separates tokens", "[tokenizer]") {
+    CHECK(tokens("") == vec{});
+    CHECK(tokens(" \t\n ") == vec{});
+    CHECK(tokens("-a 1 --bb=2 free") == vec{"-a", "1", "--bb=2", "free"});
+    CHECK(tokens("  a\t\tb\r\nc\v\fd  ") == vec{"a", "b", "c", "d"});
+    // long enough for the vector loops
+    std::string const word(100, 'x');
+    CHECK(tokens(std::string(70, ' ') + word + std::string(40, '\n') + word) ==
+          vec{word, word});
+}
+
+TEST_CASE("quotes and backslashes protect white-space", "[tokenizer]") {
+    CHECK(tokens("'a b' \"c d\"") == vec{"a b", "c d"});
+    CHECK(tokens("--name=\"foo bar\"x") == vec{"--name=foo barx"});
+    CHECK(tokens("a\\ b c") == vec{"a b", "c"});
+    CHECK(tokens("'' \"\"") == vec{"", ""});
+    CHECK(tokens("'a\\b \"c\"'") == vec{"a\\b \"c\""});
+    CHECK(tokens("\"a\\\"b\\\\c\\d 'e'\"") == vec{"a\"b\\c\\d 'e'"});
+    CHECK(tokens("\"foo \nbar\"") == vec{"foo \nbar"});
+    CHECK(tokens("a \\\n b\\\nc \"d\\\ne\"") == vec{"a", "bc", "de"});
+    CHECK(tokens("a\\") == vec{"a\\"});
+    std::string const word(50, 'y');
+    CHECK(tokens(word + "' '" + word + " " + word) ==
+          vec{word + " " + word, word});
+    // the closing quote and the escapes are blocks away from the opening
+    std::string const text(150, ' ');
+    CHECK(tokens("'" + text + "' x\"" + text + "\\\"" + text + "\"") ==
+          vec{text, "x" + text + "\"" + text});
+}
+
+TEST_CASE("an unterminated quote throws", "[tokenizer]") {
+    CHECK_THROWS_AS(tokens("a 'b c"), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(tokens("\"b\\\""), fsc::cat_on_your_keyboard_error);
+    CHECK_THROWS_AS(fsc::ArgParser("-a 'b"), fsc::cat_on_your_keyboard_error);
+}
+
+TEST_CASE("quoted values reach the parser unescaped", "[tokenizer]") {
+    fsc::ArgParser ap("--name 'foo bar' -x=\"1 2\" '3' \"-f\"");
+    CHECK(std::string(ap["name"]) == "foo bar");
+    CHECK(std::string(ap["x"]) == "1 2");
+    CHECK(ap.is_set("f"));
+    CHECK(int(ap[0]) == 3);
+}
+
+TEST_CASE("unescaped tokens stay valid until the end", "[tokenizer]") {
+    // the second token must not move the buffer of the first one
+    std::string const a(20, 'a'), b(100, 'b');
+    std::string const line = "'" + a + "' \"" + b + "\" '" + a + "'";
+    fsc::detail::tokenizer tok(line);
+    std::vector<std::string_view> const views(tok.begin(), tok.end());
+    CHECK(views == std::vector<std::string_view>{a, b, a});
+}
+
+TEST_CASE("a tokenizer reuses the buffer of the previous one", "[tokenizer]") {
+    std::string const line = "'a b' \"c d\" e --longer-than-a-small-string";
+    std::string buf;
+    {
+        fsc::detail::tokenizer tok(line, std::move(buf));
+        CHECK(vec(tok.begin(), tok.end()) ==
+              vec{"a b", "c d", "e", "--longer-than-a-small-string"});
+        buf = tok.release();
+    }
+    auto const *data = buf.data();
+    CHECK(buf.capacity() >= line.size());
+    fsc::detail::tokenizer tok(line, std::move(buf));
+    auto const first = *tok.begin();
+    CHECK(first == "a b");
+    CHECK(first.data() == data);
+}